@@ -0,0 +1,73 @@
+// Insert/erase churn with std::allocator versus PoolAllocator.
+// Every thread owns one list (and, for the pool, one pool), so any slowdown
+// with more threads comes from the shared global allocator.
+// Usage: allocator_bench [elements] [operations per thread]
+
+#include <thread>
+
+#include "bench_common.h"
+#include "../include/skip_list.h"
+#include "../include/pool_allocator.h"
+
+template <typename Allocator>
+void churn(std::size_t n, std::size_t operations, std::uint32_t seed)
+{
+    SkipList<int, std::less<>, Allocator> list;
+    std::vector<int> window = bench::shuffled_keys(n, seed);
+    for (int key : window)
+    {
+        list.insert(key);
+    }
+
+    // Sliding window: erase a resident key, insert a fresh one in its slot
+    std::mt19937 gen(seed);
+    int next_key = static_cast<int>(2 * n);
+    for (std::size_t i = 0; i < operations; ++i)
+    {
+        std::size_t slot = gen() % n;
+        list.erase(window[slot]);
+        window[slot] = next_key;
+        list.insert(next_key);
+        next_key += 2;
+    }
+    bench::do_not_optimize(list.size());
+}
+
+template <typename Allocator>
+double run(const char* name, std::size_t threads, std::size_t n, std::size_t operations)
+{
+    long long calls_before = bench::allocation_calls.load();
+
+    bench::Timer timer;
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t)
+    {
+        workers.emplace_back(churn<Allocator>, n, operations, static_cast<std::uint32_t>(t + 1));
+    }
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+    double ms = timer.elapsed_ms();
+
+    double total_ops = static_cast<double>(threads * operations * 2);
+    double calls = static_cast<double>(bench::allocation_calls.load() - calls_before);
+    std::printf("%-16s threads %2zu  %8.2f Mops/s  %6.3f operator new/op\n",
+                name, threads, total_ops / ms / 1e3, calls / total_ops);
+    return ms;
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t n = bench::size_from_args(argc, argv, 100000);
+    const std::size_t operations = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000000;
+    const std::size_t max_threads = std::max<std::size_t>(1, std::min<std::size_t>(8, std::thread::hardware_concurrency()));
+
+    std::printf("window %zu elements, %zu erase+insert pairs per thread\n", n, operations);
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        run<std::allocator<int>>("std::allocator", threads, n, operations);
+        run<PoolAllocator<int>>("PoolAllocator", threads, n, operations);
+    }
+    return 0;
+}
@@ -0,0 +1,144 @@
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+// Small helpers shared by the benchmarks in this directory.
+// Every benchmark is a single translation unit with its own main(), so the
+// global operator new/delete replacements below are defined exactly once per binary.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+
+#ifdef __APPLE__
+#include <malloc/malloc.h>
+#else
+#include <malloc.h>
+#endif
+
+namespace bench
+{
+    // Heap accounting (usable bytes as reported by malloc, so allocator rounding is included)
+    inline std::atomic<long long> live_bytes{0};
+    inline std::atomic<long long> allocation_calls{0};
+    inline std::atomic<long long> deallocation_calls{0};
+
+    inline std::size_t usable_size(void* p)
+    {
+#ifdef __APPLE__
+        return malloc_size(p);
+#else
+        return malloc_usable_size(p);
+#endif
+    }
+
+    class Timer
+    {
+        private:
+            std::chrono::steady_clock::time_point start;
+
+        public:
+            Timer() : start(std::chrono::steady_clock::now()) {}
+
+            double elapsed_ns() const
+            {
+                return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            }
+
+            double elapsed_ms() const
+            {
+                return elapsed_ns() / 1e6;
+            }
+    };
+
+    // Element count from argv[1], falling back to the given default
+    inline std::size_t size_from_args(int argc, char** argv, std::size_t fallback)
+    {
+        if (argc > 1)
+        {
+            return static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10));
+        }
+        return fallback;
+    }
+
+    // n distinct keys in random order
+    inline std::vector<int> shuffled_keys(std::size_t n, std::uint32_t seed = 42)
+    {
+        std::vector<int> keys(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            keys[i] = static_cast<int>(i * 2);
+        }
+        std::shuffle(keys.begin(), keys.end(), std::mt19937(seed));
+        return keys;
+    }
+
+    // Keeps the optimizer from dropping benchmarked results
+    template <typename V>
+    inline void do_not_optimize(const V& value)
+    {
+        asm volatile("" : : "g"(&value) : "memory");
+    }
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size)
+{
+    void* p = std::malloc(size == 0 ? 1 : size);
+    if (!p)
+    {
+        throw std::bad_alloc();
+    }
+    bench::live_bytes.fetch_add(static_cast<long long>(bench::usable_size(p)), std::memory_order_relaxed);
+    bench::allocation_calls.fetch_add(1, std::memory_order_relaxed);
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    if (p)
+    {
+        bench::live_bytes.fetch_sub(static_cast<long long>(bench::usable_size(p)), std::memory_order_relaxed);
+        bench::deallocation_calls.fetch_add(1, std::memory_order_relaxed);
+        std::free(p);
+    }
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    ::operator delete(p);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    std::size_t align = static_cast<std::size_t>(alignment);
+    void* p = std::aligned_alloc(align, (size + align - 1) / align * align);
+    if (!p)
+    {
+        throw std::bad_alloc();
+    }
+    bench::live_bytes.fetch_add(static_cast<long long>(bench::usable_size(p)), std::memory_order_relaxed);
+    bench::allocation_calls.fetch_add(1, std::memory_order_relaxed);
+    return p;
+}
+
+void operator delete(void* p, std::align_val_t) noexcept
+{
+    ::operator delete(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept
+{
+    ::operator delete(p);
+}
+
+#endif
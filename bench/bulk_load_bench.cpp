@@ -0,0 +1,54 @@
+// Loading pre-sorted keys: repeated insert() vs the sorted-range constructor.
+// Usage: bulk_load_bench [largest size]   (sizes grow by 10x from 10000; 10000000 for the full run)
+
+#include "bench_common.h"
+#include "../include/skip_list.h"
+
+namespace
+{
+    void run(std::size_t n)
+    {
+        std::vector<int> keys(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            keys[i] = static_cast<int>(i * 2);
+        }
+
+        // Best of three runs, destruction is left out
+        double insert_ms = 1e300;
+        double range_ms = 1e300;
+        for (int round = 0; round < 3; ++round)
+        {
+            {
+                bench::Timer timer;
+                SkipList<int> list;
+                for (int key : keys)
+                {
+                    list.insert(key);
+                }
+                insert_ms = std::min(insert_ms, timer.elapsed_ms());
+                bench::do_not_optimize(list);
+            }
+            {
+                bench::Timer timer;
+                SkipList<int> list(keys.begin(), keys.end());
+                range_ms = std::min(range_ms, timer.elapsed_ms());
+                bench::do_not_optimize(list);
+            }
+        }
+
+        std::printf("%10zu %14.1f %12.1f %9.1fx\n", n, insert_ms, range_ms, insert_ms / range_ms);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t largest = bench::size_from_args(argc, argv, 1000000);
+
+    std::printf("%10s %14s %12s %10s\n", "elements", "inserts ms", "range ms", "speedup");
+    for (std::size_t n = 10000; n <= largest; n *= 10)
+    {
+        run(n);
+    }
+    return 0;
+}
@@ -0,0 +1,45 @@
+// Sliding window churn: every insert is paired with the erase of the oldest key.
+// Compares allocator calls per operation with node recycling off and on.
+// Usage: churn_bench [window]
+
+#include "bench_common.h"
+#include "../include/skip_list.h"
+
+void run(const char* name, std::size_t window, std::size_t recycle_limit)
+{
+    const std::size_t operations = 2000000;
+    const std::vector<int> keys = bench::shuffled_keys(window + operations, 11);
+
+    SkipList<int> list;
+    list.set_recycle_limit(recycle_limit);
+    for (std::size_t i = 0; i < window; ++i)
+    {
+        list.insert(keys[i]);
+    }
+
+    std::size_t news_before = bench::allocation_calls.load();
+    std::size_t deletes_before = bench::deallocation_calls.load();
+    bench::Timer timer;
+    for (std::size_t i = window; i < window + operations; ++i)
+    {
+        list.erase(keys[i - window]);
+        list.insert(keys[i]);
+    }
+    double ns = timer.elapsed_ns() / static_cast<double>(operations);
+    double news = static_cast<double>(bench::allocation_calls.load() - news_before) / static_cast<double>(operations);
+    double deletes = static_cast<double>(bench::deallocation_calls.load() - deletes_before) / static_cast<double>(operations);
+
+    std::printf("%-22s %8.1f ns/op   operator new %.4f/op   operator delete %.4f/op   spare nodes %zu\n",
+                name, ns, news, deletes, list.capacity() - list.size());
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t window = bench::size_from_args(argc, argv, 100000);
+
+    std::printf("window: %zu elements, erase+insert pairs: 2000000\n", window);
+    run("recycling off", window, 0);
+    run("recycle limit 64 KiB", window, 64 * 1024);
+    run("recycle limit 1 MiB", window, 1024 * 1024);
+    return 0;
+}
@@ -0,0 +1,68 @@
+// Full scan and lookups on a list fragmented by insert/erase churn, before and after compact().
+// Usage: compact_bench [elements]
+
+#include <random>
+
+#include "bench_common.h"
+#include "../include/skip_list.h"
+
+double scan_ns(const SkipList<int>& list)
+{
+    bench::Timer timer;
+    long long sum = 0;
+    for (int value : list)
+    {
+        sum += value;
+    }
+    bench::do_not_optimize(sum);
+    return timer.elapsed_ns() / static_cast<double>(list.size());
+}
+
+double lookup_ns(const SkipList<int>& list, const std::vector<int>& probes)
+{
+    bench::Timer timer;
+    std::size_t found = 0;
+    for (int probe : probes)
+    {
+        found += list.contains(probe);
+    }
+    bench::do_not_optimize(found);
+    return timer.elapsed_ns() / static_cast<double>(probes.size());
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t n = bench::size_from_args(argc, argv, 1000000);
+    std::vector<int> keys = bench::shuffled_keys(n);
+
+    SkipList<int> list;
+    for (int key : keys)
+    {
+        list.insert(key);
+    }
+
+    // Churn: replace half of the keys so survivors and newcomers interleave on the heap
+    std::mt19937 gen(7);
+    for (std::size_t i = 0; i < n / 2; ++i)
+    {
+        list.erase(keys[i]);
+        keys[i] = static_cast<int>(gen() % (4 * n)) | 1;
+        list.insert(keys[i]);
+    }
+
+    std::vector<int> probes(keys.begin(), keys.begin() + std::min<std::size_t>(n, 200000));
+    std::shuffle(probes.begin(), probes.end(), gen);
+
+    std::printf("elements: %zu\n", list.size());
+    std::printf("before compact   scan %6.2f ns/elem   contains %7.1f ns   memory %.1f MiB\n",
+                scan_ns(list), lookup_ns(list, probes), static_cast<double>(list.memory_usage()) / (1 << 20));
+
+    bench::Timer timer;
+    std::size_t reclaimed = list.compact();
+    double compact_ms = timer.elapsed_ms();
+
+    std::printf("after compact    scan %6.2f ns/elem   contains %7.1f ns   memory %.1f MiB\n",
+                scan_ns(list), lookup_ns(list, probes), static_cast<double>(list.memory_usage()) / (1 << 20));
+    std::printf("compact: %.1f ms, %zu bytes reclaimed\n", compact_ms, reclaimed);
+    return 0;
+}
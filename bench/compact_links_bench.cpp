@@ -0,0 +1,56 @@
+// SkipList (pointer links) versus CompactSkipList (32-bit index links):
+// heap bytes per element, random lookups and a full level 0 scan.
+// Usage: compact_links_bench [elements]
+
+#include "bench_common.h"
+#include "../include/skip_list.h"
+#include "../include/compact_skip_list.h"
+
+template <typename List, typename Key>
+void run(const char* name, const std::vector<Key>& keys)
+{
+    const double n = static_cast<double>(keys.size());
+    const long long heap_before = bench::live_bytes.load();
+
+    List list;
+    for (const Key& key : keys)
+    {
+        list.insert(key);
+    }
+    const long long heap_bytes = bench::live_bytes.load() - heap_before;
+
+    std::size_t hits = 0;
+    bench::Timer lookup_timer;
+    for (std::size_t i = keys.size(); i-- > 0;)
+    {
+        hits += list.contains(keys[i]);
+    }
+    const double lookup_ns = lookup_timer.elapsed_ns() / n;
+
+    Key sum = Key();
+    bench::Timer scan_timer;
+    for (const Key& key : list)
+    {
+        sum += key;
+    }
+    const double scan_ns = scan_timer.elapsed_ns() / n;
+    bench::do_not_optimize(sum);
+    bench::do_not_optimize(hits);
+
+    std::printf("%-24s %7.2f bytes/elem   contains %7.1f ns   scan %5.2f ns/elem\n",
+                name, static_cast<double>(heap_bytes) / n, lookup_ns, scan_ns);
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t n = bench::size_from_args(argc, argv, 1000000);
+    const std::vector<int> int_keys = bench::shuffled_keys(n);
+    const std::vector<double> double_keys(int_keys.begin(), int_keys.end());
+
+    std::printf("elements: %zu\n", n);
+    run<SkipList<int>>("SkipList<int>", int_keys);
+    run<CompactSkipList<int>>("CompactSkipList<int>", int_keys);
+    run<SkipList<double>>("SkipList<double>", double_keys);
+    run<CompactSkipList<double>>("CompactSkipList<double>", double_keys);
+    return 0;
+}
@@ -0,0 +1,72 @@
+// Copying a list: element-wise inserts (the former copy constructor) vs the structural copy.
+// The source is filled in random order, so its nodes are scattered in memory, and then
+// measured again after compact(). Every timing is the best of three runs, so that fresh
+// heap pages are faulted in before the run that counts.
+// Usage: copy_bench [largest size]   (sizes grow by 10x from 10000; 10000000 for the full run)
+
+#include "bench_common.h"
+#include "../include/skip_list.h"
+
+namespace
+{
+    void run(std::size_t n, bool compacted)
+    {
+        const std::vector<int> keys = bench::shuffled_keys(n);
+        SkipList<int> source;
+        for (int key : keys)
+        {
+            source.insert(key);
+        }
+        if (compacted)
+        {
+            source.compact();
+        }
+
+        // Destruction is left out of the timings
+        double insert_ms = 1e300;
+        double copy_ms = 1e300;
+        double assign_ms = 1e300;
+        for (int round = 0; round < 3; ++round)
+        {
+            {
+                bench::Timer timer;
+                SkipList<int> copy;
+                for (int value : source)
+                {
+                    copy.insert(value);
+                }
+                insert_ms = std::min(insert_ms, timer.elapsed_ms());
+                bench::do_not_optimize(copy);
+            }
+            {
+                bench::Timer timer;
+                SkipList<int> copy(source);
+                copy_ms = std::min(copy_ms, timer.elapsed_ms());
+                bench::do_not_optimize(copy);
+            }
+            {
+                SkipList<int> target;
+                target.insert(1);
+                bench::Timer timer;
+                target = source;
+                assign_ms = std::min(assign_ms, timer.elapsed_ms());
+                bench::do_not_optimize(target);
+            }
+        }
+
+        std::printf("%-10s %10zu %14.1f %12.1f %12.1f %9.1fx\n", compacted ? "compacted" : "scattered", n, insert_ms, copy_ms, assign_ms, insert_ms / copy_ms);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t largest = bench::size_from_args(argc, argv, 1000000);
+
+    std::printf("%-10s %10s %14s %12s %12s %10s\n", "source", "elements", "inserts ms", "copy ms", "assign ms", "speedup");
+    for (std::size_t n = 10000; n <= largest; n *= 10)
+    {
+        run(n, false);
+        run(n, true);
+    }
+    return 0;
+}
@@ -0,0 +1,116 @@
+// Random lookup latency and dTLB load misses with nodes on ordinary and on huge page slabs.
+// Miss counts come from perf_event_open and are reported as n/a where the kernel refuses it.
+// Usage: huge_page_bench [elements]
+
+#include <cstring>
+#include <random>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "bench_common.h"
+#include "../include/skip_list.h"
+#include "../include/pool_allocator.h"
+
+// dTLB read misses of this thread
+class TlbMissCounter
+{
+    private:
+        int fd;
+
+    public:
+        TlbMissCounter()
+        {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        }
+
+        ~TlbMissCounter()
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+        }
+
+        bool available() const { return fd >= 0; }
+
+        void start()
+        {
+            if (fd >= 0)
+            {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+
+        long long stop()
+        {
+            long long count = 0;
+            if (fd >= 0)
+            {
+                ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+                if (read(fd, &count, sizeof(count)) != sizeof(count))
+                {
+                    count = 0;
+                }
+            }
+            return count;
+        }
+};
+
+void run(const char* name, NodePool::PageMode mode, const std::vector<int>& keys, const std::vector<int>& probes)
+{
+    SkipList<int, std::less<>, PoolAllocator<int>> list{PoolAllocator<int>(mode)};
+    for (int key : keys)
+    {
+        list.insert(key);
+    }
+
+    TlbMissCounter misses;
+    bench::Timer timer;
+    misses.start();
+    std::size_t found = 0;
+    for (int probe : probes)
+    {
+        found += list.contains(probe);
+    }
+    long long miss_count = misses.stop();
+    double ns = timer.elapsed_ns() / static_cast<double>(probes.size());
+    bench::do_not_optimize(found);
+
+    const NodePool& pool = list.get_allocator().get_pool();
+    std::printf("%-12s contains %7.1f ns   slabs %6zu (huge %zu)   dTLB misses/lookup ",
+                name, ns, pool.slab_count(), pool.huge_slab_count());
+    if (misses.available())
+    {
+        std::printf("%.2f\n", static_cast<double>(miss_count) / static_cast<double>(probes.size()));
+    }
+    else
+    {
+        std::printf("n/a\n");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t n = bench::size_from_args(argc, argv, 10000000);
+    const std::vector<int> keys = bench::shuffled_keys(n);
+
+    std::vector<int> probes(keys.begin(), keys.begin() + std::min<std::size_t>(n, 1000000));
+    std::shuffle(probes.begin(), probes.end(), std::mt19937(3));
+
+    std::printf("elements: %zu, lookups: %zu\n", n, probes.size());
+    run("4K pages", NodePool::PageMode::normal, keys, probes);
+    run("huge pages", NodePool::PageMode::huge, keys, probes);
+    return 0;
+}
@@ -0,0 +1,71 @@
+// Merging unsorted batches into a filled list: insert() per value vs insert_range().
+// Usage: insert_range_bench [list size]   (1000000 by default; batches of 10K, 100K and 1M)
+
+#include <random>
+
+#include "bench_common.h"
+#include "../include/skip_list.h"
+
+namespace
+{
+    void run(const SkipList<int>& base, std::size_t batch_size)
+    {
+        // Odd values, so every one of them is new to the list of even keys
+        std::vector<int> batch(batch_size);
+        std::mt19937 gen(static_cast<std::uint32_t>(batch_size));
+        for (int& value : batch)
+        {
+            value = static_cast<int>(gen() % (2 * base.size())) | 1;
+        }
+
+        // Best of three runs; copying the base list and destruction are left out
+        double insert_ms = 1e300;
+        double range_ms = 1e300;
+        std::size_t inserted = 0;
+        for (int round = 0; round < 3; ++round)
+        {
+            {
+                SkipList<int> list(base);
+                bench::Timer timer;
+                for (int value : batch)
+                {
+                    list.insert(value);
+                }
+                insert_ms = std::min(insert_ms, timer.elapsed_ms());
+                bench::do_not_optimize(list);
+            }
+            {
+                SkipList<int> list(base);
+                bench::Timer timer;
+                inserted = list.insert_range(batch.begin(), batch.end());
+                range_ms = std::min(range_ms, timer.elapsed_ms());
+                bench::do_not_optimize(list);
+            }
+        }
+
+        std::printf("%10zu %10zu %12.1f %12.1f %12.1f %12.1f %8.1fx\n", batch_size, inserted,
+            insert_ms, insert_ms * 1e6 / static_cast<double>(batch_size),
+            range_ms, range_ms * 1e6 / static_cast<double>(batch_size), insert_ms / range_ms);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t n = bench::size_from_args(argc, argv, 1000000);
+    const std::vector<int> keys = bench::shuffled_keys(n);
+    SkipList<int> base;
+    for (int key : keys)
+    {
+        base.insert(key);
+    }
+    // Nodes in key order, so both variants walk the same memory layout
+    base.compact();
+
+    std::printf("list of %zu elements, %u hardware threads\n", n, std::thread::hardware_concurrency());
+    std::printf("%10s %10s %12s %12s %12s %12s %9s\n", "batch", "new", "insert ms", "ns/value", "range ms", "ns/value", "speedup");
+    for (std::size_t batch_size : {10000, 100000, 1000000})
+    {
+        run(base, batch_size);
+    }
+    return 0;
+}
@@ -0,0 +1,55 @@
+// Lookups with and without successor keys cached in the forward links.
+// Usage: key_cache_bench [elements]
+
+#include <string>
+
+#include "bench_common.h"
+#include "../include/skip_list.h"
+
+template <typename List, typename Key>
+void run(const char* name, const std::vector<Key>& keys)
+{
+    const double n = static_cast<double>(keys.size());
+    const long long heap_before = bench::live_bytes.load();
+
+    List list;
+    bench::Timer insert_timer;
+    for (const Key& key : keys)
+    {
+        list.insert(key);
+    }
+    const double insert_ns = insert_timer.elapsed_ns() / n;
+    const long long heap_bytes = bench::live_bytes.load() - heap_before;
+
+    std::size_t hits = 0;
+    bench::Timer lookup_timer;
+    for (std::size_t i = keys.size(); i-- > 0;)
+    {
+        hits += list.contains(keys[i]);
+    }
+    const double lookup_ns = lookup_timer.elapsed_ns() / n;
+    bench::do_not_optimize(hits);
+
+    std::printf("%-34s %7.2f bytes/elem  insert %7.1f ns  contains %7.1f ns\n",
+                name, static_cast<double>(heap_bytes) / n, insert_ns, lookup_ns);
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t n = bench::size_from_args(argc, argv, 10000000);
+    const std::vector<int> int_keys = bench::shuffled_keys(n);
+
+    std::vector<std::string> string_keys;
+    string_keys.reserve(n);
+    for (int key : int_keys)
+    {
+        string_keys.push_back("key:" + std::to_string(key));
+    }
+
+    std::printf("elements: %zu\n", n);
+    run<SkipList<int>>("SkipList<int>", int_keys);
+    run<SkipList<int, std::less<>, std::allocator<int>, CopyKeyCache<int>>>("SkipList<int> + CopyKeyCache", int_keys);
+    run<SkipList<std::string>>("SkipList<string>", string_keys);
+    run<SkipList<std::string, std::less<>, std::allocator<std::string>, StringPrefixKeyCache>>("SkipList<string> + StringPrefix", string_keys);
+    return 0;
+}
@@ -0,0 +1,55 @@
+// Cost of drawing one tower height: the original mt19937 loop against LevelGenerator.
+// Usage: level_generator_bench [draws]
+
+#include <random>
+
+#include "bench_common.h"
+#include "../include/level_generator.h"
+
+const std::size_t MAX_LEVEL = 16;
+
+// The generator SkipList used before LevelGenerator
+std::size_t mt19937_level(std::mt19937& gen)
+{
+    std::uniform_int_distribution<> distrib(0, MAX_LEVEL);
+    std::size_t level = 0;
+    while (distrib(gen) % 2 == 0 && level < MAX_LEVEL)
+    {
+        level++;
+    }
+    return level;
+}
+
+template <typename Draw>
+void run(const char* name, std::size_t draws, Draw draw)
+{
+    std::size_t sum = 0;
+    bench::Timer timer;
+    for (std::size_t i = 0; i < draws; ++i)
+    {
+        sum += draw();
+    }
+    double ns = timer.elapsed_ns() / static_cast<double>(draws);
+    bench::do_not_optimize(sum);
+    std::printf("%-26s %6.2f ns/draw   mean level %.3f\n", name, ns, static_cast<double>(sum) / static_cast<double>(draws));
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t draws = bench::size_from_args(argc, argv, 50000000);
+
+    std::printf("draws: %zu\n", draws);
+    std::mt19937 gen(0);
+    run("mt19937 loop (p = 9/17)", draws, [&] { return mt19937_level(gen); });
+
+    LevelGenerator<0.5> half(0);
+    run("LevelGenerator p = 1/2", draws, [&] { return half(MAX_LEVEL); });
+
+    LevelGenerator<0.25> quarter(0);
+    run("LevelGenerator p = 1/4", draws, [&] { return quarter(MAX_LEVEL); });
+
+    LevelGenerator<INVERSE_E> inverse_e(0);
+    run("LevelGenerator p = 1/e", draws, [&] { return inverse_e(MAX_LEVEL); });
+
+    return 0;
+}
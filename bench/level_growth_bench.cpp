@@ -0,0 +1,45 @@
+// Lookup cost as the list grows, with levels fixed at 16 and with levels growing up to 32.
+// Usage: level_growth_bench [largest size]   (sizes grow by 10x from 1000; 100000000 for the full run)
+
+#include <random>
+
+#include "bench_common.h"
+#include "../include/skip_list.h"
+
+template <typename List>
+void run(const char* name, std::size_t n)
+{
+    const std::vector<int> keys = bench::shuffled_keys(n);
+    std::vector<int> probes(keys.begin(), keys.begin() + std::min<std::size_t>(n, 1000000));
+    std::shuffle(probes.begin(), probes.end(), std::mt19937(5));
+
+    List list;
+    for (int key : keys)
+    {
+        list.insert(key);
+    }
+
+    std::size_t found = 0;
+    bench::Timer timer;
+    for (int probe : probes)
+    {
+        found += list.contains(probe);
+    }
+    double ns = timer.elapsed_ns() / static_cast<double>(probes.size());
+    bench::do_not_optimize(found);
+
+    std::printf("%-14s %12zu %10.1f %7zu\n", name, n, ns, list.get_current_level());
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t largest = bench::size_from_args(argc, argv, 1000000);
+
+    std::printf("%-14s %12s %10s %7s\n", "levels", "elements", "lookup ns", "height");
+    for (std::size_t n = 1000; n <= largest; n *= 10)
+    {
+        run<SkipList<int, std::less<>, std::allocator<int>, NoKeyCache, LevelPolicy<0.5, 16>>>("fixed 16", n);
+        run<SkipList<int>>("growing to 32", n);
+    }
+    return 0;
+}
@@ -0,0 +1,50 @@
+// Matrix over promotion probability and list size: insert and lookup latency, node bytes per element.
+// All policies allow 32 levels, enough for p = 1/2 up to 2^32 elements.
+// Usage: level_policy_bench [largest size]   (sizes grow by 10x from 1000; 100000000 for the full matrix)
+
+#include <random>
+
+#include "bench_common.h"
+#include "../include/skip_list.h"
+
+template <double P>
+void run(const char* name, std::size_t n)
+{
+    const std::vector<int> keys = bench::shuffled_keys(n);
+    std::vector<int> probes(keys.begin(), keys.begin() + std::min<std::size_t>(n, 1000000));
+    std::shuffle(probes.begin(), probes.end(), std::mt19937(5));
+
+    SkipList<int, std::less<>, std::allocator<int>, NoKeyCache, LevelPolicy<P, 32>> list;
+    bench::Timer insert_timer;
+    for (int key : keys)
+    {
+        list.insert(key);
+    }
+    double insert_ns = insert_timer.elapsed_ns() / static_cast<double>(n);
+
+    std::size_t found = 0;
+    bench::Timer lookup_timer;
+    for (int probe : probes)
+    {
+        found += list.contains(probe);
+    }
+    double lookup_ns = lookup_timer.elapsed_ns() / static_cast<double>(probes.size());
+    bench::do_not_optimize(found);
+
+    std::printf("%-6s %12zu %10.1f %10.1f %10.2f %6zu\n", name, n, insert_ns, lookup_ns,
+                static_cast<double>(list.memory_usage()) / static_cast<double>(n), list.get_current_level());
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t largest = bench::size_from_args(argc, argv, 1000000);
+
+    std::printf("%-6s %12s %10s %10s %10s %6s\n", "p", "elements", "insert ns", "lookup ns", "bytes/elem", "levels");
+    for (std::size_t n = 1000; n <= largest; n *= 10)
+    {
+        run<0.5>("1/2", n);
+        run<0.25>("1/4", n);
+        run<INVERSE_E>("1/e", n);
+    }
+    return 0;
+}
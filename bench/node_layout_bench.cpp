@@ -0,0 +1,63 @@
+// Memory footprint and lookup latency of SkipList<int>.
+// Usage: node_layout_bench [elements]
+
+#include <algorithm>
+
+#include "bench_common.h"
+#include "../include/skip_list.h"
+
+int main(int argc, char** argv)
+{
+    const std::size_t n = bench::size_from_args(argc, argv, 1000000);
+    const std::vector<int> keys = bench::shuffled_keys(n);
+
+    const long long heap_before = bench::live_bytes.load();
+
+    SkipList<int> list;
+    bench::Timer insert_timer;
+    for (int key : keys)
+    {
+        list.insert(key);
+    }
+    const double insert_ns = insert_timer.elapsed_ns() / static_cast<double>(n);
+
+    const long long heap_bytes = bench::live_bytes.load() - heap_before;
+
+    // Lookups of present keys in a different random order
+    std::vector<int> probes = keys;
+    std::shuffle(probes.begin(), probes.end(), std::mt19937(7));
+
+    std::size_t hits = 0;
+    bench::Timer lookup_timer;
+    for (int key : probes)
+    {
+        hits += list.contains(key);
+    }
+    const double lookup_ns = lookup_timer.elapsed_ns() / static_cast<double>(n);
+    bench::do_not_optimize(hits);
+
+    std::printf("elements:          %zu\n", n);
+    std::printf("heap bytes/element %.2f\n", static_cast<double>(heap_bytes) / static_cast<double>(n));
+    std::printf("insert ns/op:      %.1f\n", insert_ns);
+    std::printf("contains ns/op:    %.1f\n", lookup_ns);
+
+    std::printf("\nheight   nodes       bytes/node   share of node bytes\n");
+    const auto stats = list.height_stats();
+    std::size_t node_bytes = 0;
+    for (const auto& height : stats)
+    {
+        node_bytes += height.nodes * height.node_bytes;
+    }
+    for (std::size_t level = 0; level < stats.size(); ++level)
+    {
+        if (stats[level].nodes == 0)
+        {
+            continue;
+        }
+        std::printf("%6zu   %-10zu  %-10zu   %5.1f%%\n", level, stats[level].nodes, stats[level].node_bytes,
+                    100.0 * static_cast<double>(stats[level].nodes * stats[level].node_bytes) / static_cast<double>(node_bytes));
+    }
+    std::printf("node bytes/element %.2f\n", static_cast<double>(node_bytes) / static_cast<double>(n));
+
+    return hits == n ? 0 : 1;
+}
@@ -0,0 +1,47 @@
+// Independent lists filled from separate threads, one list per thread.
+// With per-instance level generators nothing is shared, so throughput should grow with the thread count.
+// Usage: parallel_fill_bench [elements per list]
+
+#include <thread>
+
+#include "bench_common.h"
+#include "../include/skip_list.h"
+
+int main(int argc, char** argv)
+{
+    const std::size_t n = bench::size_from_args(argc, argv, 500000);
+    const unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    const std::vector<int> keys = bench::shuffled_keys(n);
+
+    std::printf("elements per list: %zu, hardware threads: %u\n", n, hardware);
+    for (unsigned threads = 1; threads <= hardware * 2; threads *= 2)
+    {
+        std::vector<SkipList<int>> lists;
+        for (unsigned i = 0; i < threads; ++i)
+        {
+            lists.emplace_back(std::uint64_t(i));
+        }
+
+        bench::Timer timer;
+        std::vector<std::thread> workers;
+        for (unsigned i = 0; i < threads; ++i)
+        {
+            workers.emplace_back([&lists, &keys, i]
+            {
+                for (int key : keys)
+                {
+                    lists[i].insert(key);
+                }
+            });
+        }
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+        double seconds = timer.elapsed_ms() / 1000.0;
+
+        std::printf("threads %2u   %7.2f M inserts/s total\n", threads,
+                    static_cast<double>(n) * threads / seconds / 1e6);
+    }
+    return 0;
+}
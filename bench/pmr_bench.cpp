@@ -0,0 +1,46 @@
+// Build and teardown of a short-lived list on the global heap and on a monotonic arena.
+// Usage: pmr_bench [elements]
+
+#include <memory_resource>
+
+#include "bench_common.h"
+#include "../include/skip_list.h"
+
+template <typename List, typename... Args>
+void run(const char* name, const std::vector<int>& keys, Args&&... args)
+{
+    std::size_t calls_before = bench::allocation_calls.load();
+    bench::Timer build_timer;
+    auto list = std::make_unique<List>(std::forward<Args>(args)...);
+    for (int key : keys)
+    {
+        list->insert(key);
+    }
+    double build_ms = build_timer.elapsed_ms();
+    std::size_t calls = bench::allocation_calls.load() - calls_before;
+
+    bench::Timer destroy_timer;
+    list.reset();
+    double destroy_ms = destroy_timer.elapsed_ms();
+
+    std::printf("%-20s build %8.1f ms   teardown %7.1f ms   operator new calls %zu\n",
+                name, build_ms, destroy_ms, calls);
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t n = bench::size_from_args(argc, argv, 1000000);
+    const std::vector<int> keys = bench::shuffled_keys(n);
+
+    std::printf("elements: %zu\n", n);
+    run<SkipList<int>>("std::allocator", keys);
+    {
+        std::pmr::monotonic_buffer_resource arena;
+        run<pmr::SkipList<int>>("monotonic arena", keys, &arena);
+
+        bench::Timer release_timer;
+        arena.release();
+        std::printf("%-20s arena release %.1f ms\n", "", release_timer.elapsed_ms());
+    }
+    return 0;
+}
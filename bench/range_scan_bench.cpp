@@ -0,0 +1,70 @@
+// Range scans of a fixed length, starting at the first element >= a random key.
+// The seek is either a linear std::find_if from begin() or lower_bound().
+// Usage: range_scan_bench [elements]
+
+#include <algorithm>
+
+#include "bench_common.h"
+#include "../include/skip_list.h"
+
+int main(int argc, char** argv)
+{
+    const std::size_t n = bench::size_from_args(argc, argv, 1000000);
+    const std::size_t scan_length = 100;
+
+    SkipList<int> list;
+    for (int key : bench::shuffled_keys(n))
+    {
+        list.insert(key);
+    }
+
+    // Start keys fall between elements half of the time
+    std::mt19937 gen(3);
+    std::vector<int> starts(1000);
+    for (int& start : starts)
+    {
+        start = static_cast<int>(gen() % (2 * n));
+    }
+
+    auto scan = [&](SkipList<int>::iterator it)
+    {
+        long long sum = 0;
+        for (std::size_t i = 0; i < scan_length && it != list.end(); ++i, ++it)
+        {
+            sum += *it;
+        }
+        return sum;
+    };
+
+    // The linear seek is O(n), so it only gets a tenth of the queries
+    const std::size_t linear_queries = starts.size() / 10;
+    long long linear_sum = 0;
+    bench::Timer linear_timer;
+    for (std::size_t q = 0; q < linear_queries; ++q)
+    {
+        const int start = starts[q];
+        linear_sum += scan(std::find_if(list.begin(), list.end(), [start](int value) { return value >= start; }));
+    }
+    const double linear_us = linear_timer.elapsed_ns() / 1e3 / static_cast<double>(linear_queries);
+
+    long long seek_sum = 0;
+    long long seek_prefix_sum = 0;
+    bench::Timer seek_timer;
+    for (std::size_t q = 0; q < starts.size(); ++q)
+    {
+        const long long sum = scan(list.lower_bound(starts[q]));
+        seek_sum += sum;
+        if (q < linear_queries)
+        {
+            seek_prefix_sum += sum;
+        }
+    }
+    const double seek_us = seek_timer.elapsed_ns() / 1e3 / static_cast<double>(starts.size());
+    bench::do_not_optimize(seek_sum);
+
+    std::printf("elements: %zu, scan length: %zu\n", n, scan_length);
+    std::printf("find_if + scan      %10.2f us/query\n", linear_us);
+    std::printf("lower_bound + scan  %10.2f us/query\n", seek_us);
+    std::printf("results %s\n", linear_sum == seek_prefix_sum ? "match" : "DIFFER");
+    return linear_sum == seek_prefix_sum ? 0 : 1;
+}
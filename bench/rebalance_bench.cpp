@@ -0,0 +1,75 @@
+// Search path length and lookup cost after heavy erasure, before and after rebalance(),
+// and after a compact() of the rebalanced list.
+// Usage: rebalance_bench [elements]   (1000000 by default; 9 of every 10 elements are erased)
+
+#include <random>
+
+#include "bench_common.h"
+#include "../include/skip_list.h"
+
+namespace
+{
+    double lookup_ns(const SkipList<int>& list, const std::vector<int>& probes)
+    {
+        std::size_t found = 0;
+        bench::Timer timer;
+        for (int probe : probes)
+        {
+            found += list.contains(probe);
+        }
+        double ns = timer.elapsed_ns() / static_cast<double>(probes.size());
+        bench::do_not_optimize(found);
+        return ns;
+    }
+
+    void print(const char* state, const SkipList<int>& list, const std::vector<int>& probes)
+    {
+        std::printf("%-18s %10zu %7zu %12.2f %10.1f\n",
+            state, list.size(), list.get_current_level(), list.average_search_length(), lookup_ns(list, probes));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t n = bench::size_from_args(argc, argv, 1000000);
+    const std::vector<int> keys = bench::shuffled_keys(n);
+
+    SkipList<int> list(1);
+    for (int key : keys)
+    {
+        list.insert(key);
+    }
+
+    std::vector<int> kept;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (i % 10 == 0)
+        {
+            kept.push_back(keys[i]);
+        }
+    }
+    std::vector<int> probes(kept.begin(), kept.begin() + std::min<std::size_t>(kept.size(), 1000000));
+    std::shuffle(probes.begin(), probes.end(), std::mt19937(5));
+
+    std::printf("%-18s %10s %7s %12s %10s\n", "state", "elements", "height", "avg search", "lookup ns");
+    print("filled", list, probes);
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (i % 10 != 0)
+        {
+            list.erase(keys[i]);
+        }
+    }
+    print("after erasing 90%", list, probes);
+
+    bench::Timer timer;
+    list.rebalance();
+    double rebalance_ms = timer.elapsed_ms();
+    print("rebalanced", list, probes);
+    std::printf("rebalance() took %.2f ms\n", rebalance_ms);
+
+    list.compact();
+    print("compacted", list, probes);
+    return 0;
+}
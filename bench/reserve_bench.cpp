@@ -0,0 +1,61 @@
+// Bulk insert with and without reserve(), and the memory shrink_to_fit() hands back
+// when most of a reservation stays unused.
+// Usage: reserve_bench [elements]
+
+#include "bench_common.h"
+#include "../include/skip_list.h"
+
+void run(const char* name, const std::vector<int>& keys, bool reserve)
+{
+    SkipList<int> list;
+
+    bench::Timer reserve_timer;
+    if (reserve)
+    {
+        list.reserve(keys.size());
+    }
+    double reserve_ms = reserve_timer.elapsed_ms();
+
+    std::size_t calls_before = bench::allocation_calls.load();
+    bench::Timer insert_timer;
+    for (int key : keys)
+    {
+        list.insert(key);
+    }
+    double insert_ms = insert_timer.elapsed_ms();
+    std::size_t calls = bench::allocation_calls.load() - calls_before;
+
+    std::printf("%-12s reserve %7.1f ms   insert %9.1f ms (%6.1f ns/elem, %.2f allocations/elem)\n",
+                name, reserve_ms, insert_ms, insert_ms * 1e6 / static_cast<double>(keys.size()),
+                static_cast<double>(calls) / static_cast<double>(keys.size()));
+}
+
+// Reserve for everything, keep only a tenth, give the rest back
+void shrink(const std::vector<int>& keys)
+{
+    SkipList<int> list;
+    list.reserve(keys.size());
+    for (std::size_t i = 0; i < keys.size() / 10; ++i)
+    {
+        list.insert(keys[i]);
+    }
+
+    std::size_t before = bench::live_bytes.load();
+    list.shrink_to_fit();
+    std::size_t after = bench::live_bytes.load();
+
+    std::printf("shrink_to_fit with 10%% of the reservation used: %.1f MiB -> %.1f MiB\n",
+                static_cast<double>(before) / (1 << 20), static_cast<double>(after) / (1 << 20));
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t n = bench::size_from_args(argc, argv, 1000000);
+    const std::vector<int> keys = bench::shuffled_keys(n);
+
+    std::printf("elements: %zu\n", n);
+    run("no reserve", keys, false);
+    run("reserve(n)", keys, true);
+    shrink(keys);
+    return 0;
+}
@@ -0,0 +1,93 @@
+// Lookups of std::string elements from std::string_view keys. With std::less<std::string>
+// every query builds a temporary string; the transparent std::less<> compares the view as is.
+// Usage: string_view_lookup_bench [elements]
+
+#include <string>
+#include <string_view>
+
+#include "bench_common.h"
+#include "../include/skip_list.h"
+
+template <typename List>
+void run(const char* name, const std::vector<std::string>& keys, const std::vector<std::string_view>& queries)
+{
+    List list;
+    for (const std::string& key : keys)
+    {
+        list.insert(key);
+    }
+
+    // Best of three passes, the machine is noisy
+    const double n = static_cast<double>(queries.size());
+    const long long calls_before = bench::allocation_calls.load();
+    std::size_t hits = 0;
+    double lookup_ns = 0;
+    for (int pass = 0; pass < 3; ++pass)
+    {
+        hits = 0;
+        bench::Timer timer;
+        for (std::string_view query : queries)
+        {
+            if constexpr (requires { typename List::key_compare::is_transparent; })
+            {
+                hits += list.contains(query);
+            }
+            else
+            {
+                hits += list.contains(std::string(query));
+            }
+        }
+        const double pass_ns = timer.elapsed_ns() / n;
+        lookup_ns = pass == 0 ? pass_ns : std::min(lookup_ns, pass_ns);
+        bench::do_not_optimize(hits);
+    }
+    const long long calls = (bench::allocation_calls.load() - calls_before) / 3;
+
+    std::printf("%-40s contains %7.1f ns  %5.2f allocations/lookup  hits %zu\n",
+                name, lookup_ns, static_cast<double>(calls) / n, hits);
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t n = bench::size_from_args(argc, argv, 1000000);
+    const std::vector<int> ids = bench::shuffled_keys(n);
+
+    // Longer than the small string buffer, as URLs or paths usually are
+    std::vector<std::string> keys;
+    keys.reserve(n);
+    for (int id : ids)
+    {
+        keys.push_back("/api/v2/resources/item-" + std::to_string(id));
+    }
+
+    // Half hits, half misses (odd ids), looked up in a different order
+    std::vector<std::string> misses;
+    misses.reserve(n / 2);
+    for (std::size_t i = 0; i < n / 2; ++i)
+    {
+        misses.push_back("/api/v2/resources/item-" + std::to_string(ids[i] + 1));
+    }
+    std::vector<std::string_view> queries;
+    queries.reserve(n);
+    for (std::size_t i = n; i-- > n / 2;)
+    {
+        queries.push_back(keys[i]);
+    }
+    for (const std::string& miss : misses)
+    {
+        queries.push_back(miss);
+    }
+    std::shuffle(queries.begin(), queries.end(), std::mt19937(7));
+
+    using StringLess = std::less<std::string>;
+    using Cache = StringPrefixKeyCache;
+
+    std::printf("elements: %zu, lookups: %zu\n", n, queries.size());
+    run<SkipList<std::string, StringLess>>(
+        "less<string>, temporary string", keys, queries);
+    run<SkipList<std::string>>("less<>, string_view", keys, queries);
+    run<SkipList<std::string, StringLess, std::allocator<std::string>, Cache>>(
+        "less<string> + StringPrefix, temporary", keys, queries);
+    run<SkipList<std::string, std::less<>, std::allocator<std::string>, Cache>>("less<> + StringPrefix, string_view", keys, queries);
+    return 0;
+}
@@ -0,0 +1,97 @@
+// Latency distribution of single operations: randomized SkipList vs the deterministic 1-2-3 list.
+// Every operation is timed on its own, so the numbers include ~20 ns of clock overhead.
+// Usage: tail_latency_bench [elements]   (1000000 by default; 10000000 for the full run)
+
+#include <random>
+
+#include "bench_common.h"
+#include "../include/deterministic_skip_list.h"
+#include "../include/skip_list.h"
+
+namespace
+{
+    struct Percentiles
+    {
+        double p50;
+        double p99;
+        double p999;
+        double p9999;
+        double max;
+    };
+
+    Percentiles percentiles(std::vector<double>& samples)
+    {
+        std::sort(samples.begin(), samples.end());
+        auto at = [&](double q)
+        {
+            return samples[static_cast<std::size_t>(q * static_cast<double>(samples.size() - 1))];
+        };
+        return {at(0.5), at(0.99), at(0.999), at(0.9999), samples.back()};
+    }
+
+    void print(const char* list_name, const char* operation, std::vector<double>& samples)
+    {
+        Percentiles p = percentiles(samples);
+        std::printf("%-14s %-9s %9.0f %9.0f %9.0f %9.0f %10.0f\n",
+            list_name, operation, p.p50, p.p99, p.p999, p.p9999, p.max);
+    }
+
+    template <typename List>
+    void run(const char* name, const std::vector<int>& keys, const std::vector<int>& probes)
+    {
+        std::vector<double> samples;
+        samples.reserve(keys.size());
+
+        List list;
+        for (int key : keys)
+        {
+            bench::Timer timer;
+            list.insert(key);
+            samples.push_back(timer.elapsed_ns());
+        }
+        print(name, "insert", samples);
+
+        samples.clear();
+        std::size_t found = 0;
+        for (int probe : probes)
+        {
+            bench::Timer timer;
+            found += list.contains(probe);
+            samples.push_back(timer.elapsed_ns());
+        }
+        bench::do_not_optimize(found);
+        print(name, "contains", samples);
+
+        samples.clear();
+        for (int probe : probes)
+        {
+            bench::Timer timer;
+            found += list.erase(probe);
+            samples.push_back(timer.elapsed_ns());
+        }
+        bench::do_not_optimize(found);
+        print(name, "erase", samples);
+
+        std::printf("%-14s height %zu\n", name, list.get_current_level() + 1);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t n = bench::size_from_args(argc, argv, 1000000);
+    const std::vector<int> keys = bench::shuffled_keys(n);
+
+    // Half hits, half misses (shuffled_keys only produces even keys)
+    std::vector<int> probes(keys.begin(), keys.begin() + std::min<std::size_t>(n, 1000000));
+    for (std::size_t i = 0; i < probes.size(); i += 2)
+    {
+        probes[i] += 1;
+    }
+    std::shuffle(probes.begin(), probes.end(), std::mt19937(5));
+
+    std::printf("%zu elements, latency in ns\n", n);
+    std::printf("%-14s %-9s %9s %9s %9s %9s %10s\n", "list", "operation", "p50", "p99", "p99.9", "p99.99", "max");
+    run<SkipList<int>>("randomized", keys, probes);
+    run<DeterministicSkipList<int>>("deterministic", keys, probes);
+    return 0;
+}
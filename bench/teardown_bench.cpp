@@ -0,0 +1,49 @@
+// Cost of clear() and of the destructor on a large list.
+// Keys are inserted in random order, so level 0 is scattered over the heap.
+// Usage: teardown_bench [elements]
+
+#include <memory>
+
+#include "bench_common.h"
+#include "../include/skip_list.h"
+#include "../include/pool_allocator.h"
+
+template <typename Allocator>
+std::unique_ptr<SkipList<int, std::less<>, Allocator>> build(const std::vector<int>& keys)
+{
+    auto list = std::make_unique<SkipList<int, std::less<>, Allocator>>();
+    for (int key : keys)
+    {
+        list->insert(key);
+    }
+    return list;
+}
+
+template <typename Allocator>
+void run(const char* name, const std::vector<int>& keys)
+{
+    auto list = build<Allocator>(keys);
+    bench::Timer clear_timer;
+    list->clear();
+    double clear_ms = clear_timer.elapsed_ms();
+
+    list = build<Allocator>(keys);
+    bench::Timer destroy_timer;
+    list.reset();
+    double destroy_ms = destroy_timer.elapsed_ms();
+
+    std::printf("%-16s clear %9.1f ms (%5.1f ns/elem)   destructor %9.1f ms (%5.1f ns/elem)\n",
+                name, clear_ms, clear_ms * 1e6 / static_cast<double>(keys.size()),
+                destroy_ms, destroy_ms * 1e6 / static_cast<double>(keys.size()));
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t n = bench::size_from_args(argc, argv, 10000000);
+    const std::vector<int> keys = bench::shuffled_keys(n);
+
+    std::printf("elements: %zu\n", n);
+    run<std::allocator<int>>("std::allocator", keys);
+    run<PoolAllocator<int>>("PoolAllocator", keys);
+    return 0;
+}
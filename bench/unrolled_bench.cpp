@@ -0,0 +1,57 @@
+// Point lookups and full scans: SkipList<int> versus UnrolledSkipList<int>
+// with several block capacities.
+// Usage: unrolled_bench [elements]
+
+#include "bench_common.h"
+#include "../include/skip_list.h"
+#include "../include/unrolled_skip_list.h"
+
+template <typename List>
+void run(const char* name, const std::vector<int>& keys)
+{
+    const double n = static_cast<double>(keys.size());
+    const long long heap_before = bench::live_bytes.load();
+
+    List list;
+    bench::Timer insert_timer;
+    for (int key : keys)
+    {
+        list.insert(key);
+    }
+    const double insert_ns = insert_timer.elapsed_ns() / n;
+    const long long heap_bytes = bench::live_bytes.load() - heap_before;
+
+    std::size_t hits = 0;
+    bench::Timer lookup_timer;
+    for (std::size_t i = keys.size(); i-- > 0;)
+    {
+        hits += list.contains(keys[i]);
+    }
+    const double lookup_ns = lookup_timer.elapsed_ns() / n;
+
+    long long sum = 0;
+    bench::Timer scan_timer;
+    for (int key : list)
+    {
+        sum += key;
+    }
+    const double scan_ns = scan_timer.elapsed_ns() / n;
+    bench::do_not_optimize(sum);
+    bench::do_not_optimize(hits);
+
+    std::printf("%-26s %6.2f bytes/elem  insert %7.1f ns  contains %7.1f ns  scan %6.2f ns/elem\n",
+                name, static_cast<double>(heap_bytes) / n, insert_ns, lookup_ns, scan_ns);
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t n = bench::size_from_args(argc, argv, 1000000);
+    const std::vector<int> keys = bench::shuffled_keys(n);
+
+    std::printf("elements: %zu\n", n);
+    run<SkipList<int>>("SkipList<int>", keys);
+    run<UnrolledSkipList<int, 16>>("UnrolledSkipList<int, 16>", keys);
+    run<UnrolledSkipList<int, 32>>("UnrolledSkipList<int, 32>", keys);
+    run<UnrolledSkipList<int, 64>>("UnrolledSkipList<int, 64>", keys);
+    return 0;
+}
@@ -0,0 +1,679 @@
+#ifndef COMPACT_SKIP_LIST_H
+#define COMPACT_SKIP_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "level_generator.h"
+
+// Skip list with 32-bit index links instead of pointers.
+// Nodes live in one contiguous slot array and towers hold slot indices, which
+// halves link memory for small keys such as int and double. The level 0 link
+// sits in the slot next to the value, so a level 0 step touches a single slot.
+// Upper links live in a separate word array:
+//
+//     slots[s] = { value, next0, upper }
+//     links[upper] = level, links[upper + i] = next slot at level i (1 <= i <= level)
+//
+// Level 0 nodes (about half of them) have no upper tower at all. Freed slots
+// and towers are reused by later inserts. Iterators hold a slot index, so they
+// stay valid across inserts and are only invalidated by erasing their element.
+// A freed slot destroys its value right away, so an erased string gives its
+// buffer back without waiting for the slot to be reused.
+template <typename T, typename LevelPolicy = ::LevelPolicy<>>
+class CompactSkipList
+{
+    private:
+        static const std::size_t MAX_LEVEL = LevelPolicy::max_level;
+        static constexpr std::uint32_t NIL = 0xFFFFFFFFu;
+        // upper of a free slot, whose value has been destroyed
+        static constexpr std::uint32_t FREE = NIL - 1;
+
+        struct Slot
+        {
+            // Union so that a free slot can exist without a value
+            union
+            {
+                T value;
+            };
+            std::uint32_t next0;
+            std::uint32_t upper;
+
+            Slot(const T& _value, std::uint32_t _next0, std::uint32_t _upper) : value(_value), next0(_next0), upper(_upper) {}
+
+            Slot(const Slot& other) : next0(other.next0), upper(other.upper)
+            {
+                if (upper != FREE)
+                {
+                    std::construct_at(std::addressof(value), other.value);
+                }
+            }
+
+            Slot(Slot&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : next0(other.next0), upper(other.upper)
+            {
+                if (upper != FREE)
+                {
+                    std::construct_at(std::addressof(value), std::move(other.value));
+                }
+            }
+
+            Slot& operator=(const Slot&) = delete;
+
+            ~Slot()
+            {
+                if (upper != FREE)
+                {
+                    value.~T();
+                }
+            }
+        };
+
+        std::vector<Slot> slots;
+        std::vector<std::uint32_t> links;
+
+        std::uint32_t head[MAX_LEVEL + 1];
+
+        // Free slots are chained through next0, free towers of each level through their first word
+        std::uint32_t free_slots;
+        std::uint32_t free_towers[MAX_LEVEL + 1];
+
+        std::size_t current_level;
+        std::size_t num_elements;
+
+        // Levels are drawn up to level_cap, which grows with num_elements as in SkipList
+        std::size_t level_cap;
+        double next_cap_growth;
+
+        // Every list draws its levels from its own generator
+        typename LevelPolicy::generator_type level_generator;
+        std::size_t get_random_level();
+        void update_level_cap();
+
+        std::uint32_t& link(std::uint32_t slot, std::size_t level);
+        std::uint32_t link(std::uint32_t slot, std::size_t level) const;
+        std::size_t level_of(std::uint32_t slot) const;
+
+        std::uint32_t allocate_slot(const T& value, std::size_t level);
+        void free_slot(std::uint32_t slot);
+        void free_tower(std::uint32_t upper);
+
+        // Last slot at every level whose value is less than value (NIL means head)
+        std::uint32_t find_predecessors(const T& value, std::uint32_t* update) const;
+
+        void reset();
+
+    public:
+        // ==============================
+
+        class const_iterator;
+
+        class iterator
+        {
+            private:
+                CompactSkipList* list;
+                std::uint32_t slot;
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = T*;
+                using reference = T&;
+
+                friend class const_iterator;
+
+                explicit iterator(CompactSkipList* owner = nullptr, std::uint32_t index = NIL) : list(owner), slot(index) {}
+
+                reference operator*() const
+                {
+                    if (slot == NIL)
+                    {
+                        throw std::out_of_range("Dereferencing null iterator.");
+                    }
+                    return list->slots[slot].value;
+                }
+
+                pointer operator->() const
+                {
+                    return &(**this);
+                }
+
+                iterator& operator++()
+                {
+                    if (slot != NIL)
+                    {
+                        slot = list->slots[slot].next0;
+                    }
+                    return *this;
+                }
+
+                iterator operator++(int)
+                {
+                    iterator temp = *this;
+                    ++(*this);
+                    return temp;
+                }
+
+                bool operator==(const iterator& other) const { return slot == other.slot; }
+                bool operator!=(const iterator& other) const { return slot != other.slot; }
+
+                bool operator==(const const_iterator& other) const { return slot == other.slot; }
+                bool operator!=(const const_iterator& other) const { return slot != other.slot; }
+        };
+
+        class const_iterator
+        {
+            friend class iterator;
+            private:
+                const CompactSkipList* list;
+                std::uint32_t slot;
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const T*;
+                using reference = const T&;
+
+                explicit const_iterator(const CompactSkipList* owner = nullptr, std::uint32_t index = NIL) : list(owner), slot(index) {}
+
+                // transition constructor
+                const_iterator(const iterator& other) : list(other.list), slot(other.slot) {}
+
+                reference operator*() const
+                {
+                    if (slot == NIL)
+                    {
+                        throw std::out_of_range("Dereferencing null iterator.");
+                    }
+                    return list->slots[slot].value;
+                }
+
+                pointer operator->() const
+                {
+                    return &(**this);
+                }
+
+                const_iterator& operator++()
+                {
+                    if (slot != NIL)
+                    {
+                        slot = list->slots[slot].next0;
+                    }
+                    return *this;
+                }
+
+                const_iterator operator++(int)
+                {
+                    const_iterator temp = *this;
+                    ++(*this);
+                    return temp;
+                }
+
+                bool operator==(const const_iterator& other) const { return slot == other.slot; }
+                bool operator!=(const const_iterator& other) const { return slot != other.slot; }
+
+                bool operator==(const iterator& other) const { return slot == other.slot; }
+                bool operator!=(const iterator& other) const { return slot != other.slot; }
+        };
+
+        iterator begin() { return iterator(this, head[0]); }
+        const_iterator begin() const { return const_iterator(this, head[0]); }
+        iterator end() { return iterator(this, NIL); }
+        const_iterator end() const { return const_iterator(this, NIL); }
+        const_iterator cbegin() const { return const_iterator(this, head[0]); }
+        const_iterator cend() const { return const_iterator(this, NIL); }
+
+        // ======================
+
+        CompactSkipList();
+        // Seeds the level generator, so that the same inserts always build the same towers
+        explicit CompactSkipList(std::uint64_t seed);
+        ~CompactSkipList() = default;
+
+        // A copy draws its later levels from a generator of its own
+        CompactSkipList(const CompactSkipList& other);
+        CompactSkipList(CompactSkipList&& other) noexcept;
+
+        std::size_t get_current_level() const;
+        std::size_t size() const;
+        bool empty() const;
+
+        // Bytes held by the slot and link arrays, including unused capacity
+        std::size_t memory_usage() const;
+
+        void clear() noexcept;
+
+        // Returns the element equal to value and whether it was inserted
+        std::pair<iterator, bool> insert(const T& value);
+        bool contains(const T& value) const;
+        bool erase(const T& value);
+
+        bool operator==(const CompactSkipList& other) const;
+        bool operator!=(const CompactSkipList& other) const;
+        CompactSkipList& operator=(const CompactSkipList& other);
+        CompactSkipList& operator=(CompactSkipList&& other) noexcept;
+        bool operator<(const CompactSkipList& other) const;
+        bool operator>(const CompactSkipList& other) const;
+        bool operator<=(const CompactSkipList& other) const;
+        bool operator>=(const CompactSkipList& other) const;
+};
+
+template <typename T, typename LevelPolicy>
+CompactSkipList<T, LevelPolicy>::CompactSkipList() : CompactSkipList(random_level_seed()) {}
+
+template <typename T, typename LevelPolicy>
+CompactSkipList<T, LevelPolicy>::CompactSkipList(std::uint64_t seed) : level_generator(seed)
+{
+    reset();
+}
+
+template <typename T, typename LevelPolicy>
+CompactSkipList<T, LevelPolicy>::CompactSkipList(const CompactSkipList& other) :
+    slots(other.slots), links(other.links),
+    free_slots(other.free_slots),
+    current_level(other.current_level), num_elements(other.num_elements),
+    level_cap(other.level_cap), next_cap_growth(other.next_cap_growth),
+    level_generator(random_level_seed())
+{
+    for (std::size_t i = 0; i <= MAX_LEVEL; ++i)
+    {
+        head[i] = other.head[i];
+        free_towers[i] = other.free_towers[i];
+    }
+}
+
+template <typename T, typename LevelPolicy>
+CompactSkipList<T, LevelPolicy>::CompactSkipList(CompactSkipList&& other) noexcept :
+    slots(std::move(other.slots)), links(std::move(other.links)),
+    free_slots(other.free_slots),
+    current_level(other.current_level), num_elements(other.num_elements),
+    level_cap(other.level_cap), next_cap_growth(other.next_cap_growth),
+    level_generator(other.level_generator)
+{
+    for (std::size_t i = 0; i <= MAX_LEVEL; ++i)
+    {
+        head[i] = other.head[i];
+        free_towers[i] = other.free_towers[i];
+    }
+    other.clear();
+}
+
+template <typename T, typename LevelPolicy>
+void CompactSkipList<T, LevelPolicy>::reset()
+{
+    for (std::size_t i = 0; i <= MAX_LEVEL; ++i)
+    {
+        head[i] = NIL;
+        free_towers[i] = NIL;
+    }
+    free_slots = NIL;
+    current_level = 0;
+    num_elements = 0;
+    level_cap = 1;
+    next_cap_growth = 1.0 / LevelPolicy::probability;
+}
+
+template <typename T, typename LevelPolicy>
+std::size_t CompactSkipList<T, LevelPolicy>::get_random_level()
+{
+    return level_generator(level_cap);
+}
+
+template <typename T, typename LevelPolicy>
+void CompactSkipList<T, LevelPolicy>::update_level_cap()
+{
+    if (level_cap < MAX_LEVEL && static_cast<double>(num_elements) >= next_cap_growth)
+    {
+        level_cap++;
+        next_cap_growth /= LevelPolicy::probability;
+    }
+}
+
+template <typename T, typename LevelPolicy>
+std::uint32_t& CompactSkipList<T, LevelPolicy>::link(std::uint32_t slot, std::size_t level)
+{
+    if (slot == NIL)
+    {
+        return head[level];
+    }
+    if (level == 0)
+    {
+        return slots[slot].next0;
+    }
+    return links[slots[slot].upper + level];
+}
+
+template <typename T, typename LevelPolicy>
+std::uint32_t CompactSkipList<T, LevelPolicy>::link(std::uint32_t slot, std::size_t level) const
+{
+    if (slot == NIL)
+    {
+        return head[level];
+    }
+    if (level == 0)
+    {
+        return slots[slot].next0;
+    }
+    return links[slots[slot].upper + level];
+}
+
+template <typename T, typename LevelPolicy>
+std::size_t CompactSkipList<T, LevelPolicy>::level_of(std::uint32_t slot) const
+{
+    std::uint32_t upper = slots[slot].upper;
+    return upper == NIL ? 0 : links[upper];
+}
+
+template <typename T, typename LevelPolicy>
+std::uint32_t CompactSkipList<T, LevelPolicy>::allocate_slot(const T& value, std::size_t level)
+{
+    std::uint32_t upper = NIL;
+    if (level > 0)
+    {
+        if (free_towers[level] != NIL)
+        {
+            upper = free_towers[level];
+            free_towers[level] = links[upper];
+        }
+        else
+        {
+            if (links.size() + level + 1 > FREE)
+            {
+                throw std::length_error("CompactSkipList link storage exceeds 32-bit indices.");
+            }
+            upper = static_cast<std::uint32_t>(links.size());
+            links.resize(links.size() + level + 1);
+        }
+        links[upper] = static_cast<std::uint32_t>(level);
+    }
+
+    // A throwing copy of value hands the tower to the free list instead of leaking it
+    try
+    {
+        std::uint32_t slot;
+        if (free_slots != NIL)
+        {
+            slot = free_slots;
+            std::construct_at(std::addressof(slots[slot].value), value);
+            free_slots = slots[slot].next0;
+            slots[slot].upper = upper;
+        }
+        else
+        {
+            if (slots.size() >= FREE)
+            {
+                throw std::length_error("CompactSkipList exceeds 32-bit slot indices.");
+            }
+            slot = static_cast<std::uint32_t>(slots.size());
+            slots.emplace_back(value, NIL, upper);
+        }
+        return slot;
+    }
+    catch (...)
+    {
+        if (upper != NIL)
+        {
+            free_tower(upper);
+        }
+        throw;
+    }
+}
+
+template <typename T, typename LevelPolicy>
+void CompactSkipList<T, LevelPolicy>::free_slot(std::uint32_t slot)
+{
+    std::uint32_t upper = slots[slot].upper;
+    if (upper != NIL)
+    {
+        free_tower(upper);
+    }
+
+    slots[slot].value.~T();
+    slots[slot].next0 = free_slots;
+    slots[slot].upper = FREE;
+    free_slots = slot;
+}
+
+template <typename T, typename LevelPolicy>
+void CompactSkipList<T, LevelPolicy>::free_tower(std::uint32_t upper)
+{
+    std::size_t level = links[upper];
+    links[upper] = free_towers[level];
+    free_towers[level] = upper;
+}
+
+template <typename T, typename LevelPolicy>
+std::uint32_t CompactSkipList<T, LevelPolicy>::find_predecessors(const T& value, std::uint32_t* update) const
+{
+    std::uint32_t current = NIL;
+
+    for (std::size_t i = current_level + 1; i-- > 0;)
+    {
+        std::uint32_t next = link(current, i);
+        while (next != NIL && slots[next].value < value)
+        {
+            current = next;
+            next = link(current, i);
+        }
+        if (update)
+        {
+            update[i] = current;
+        }
+    }
+    return current;
+}
+
+template <typename T, typename LevelPolicy>
+std::size_t CompactSkipList<T, LevelPolicy>::get_current_level() const
+{
+    return current_level;
+}
+
+template <typename T, typename LevelPolicy>
+std::size_t CompactSkipList<T, LevelPolicy>::size() const
+{
+    return num_elements;
+}
+
+template <typename T, typename LevelPolicy>
+bool CompactSkipList<T, LevelPolicy>::empty() const
+{
+    return num_elements == 0;
+}
+
+template <typename T, typename LevelPolicy>
+std::size_t CompactSkipList<T, LevelPolicy>::memory_usage() const
+{
+    return slots.capacity() * sizeof(Slot) + links.capacity() * sizeof(std::uint32_t);
+}
+
+template <typename T, typename LevelPolicy>
+void CompactSkipList<T, LevelPolicy>::clear() noexcept
+{
+    slots.clear();
+    links.clear();
+    reset();
+}
+
+template <typename T, typename LevelPolicy>
+std::pair<typename CompactSkipList<T, LevelPolicy>::iterator, bool> CompactSkipList<T, LevelPolicy>::insert(const T& value)
+{
+    std::uint32_t update[MAX_LEVEL + 1];
+    std::uint32_t current = find_predecessors(value, update);
+
+    // checking for dublicates
+    std::uint32_t next = link(current, 0);
+    if (next != NIL && slots[next].value == value)
+    {
+        return {iterator(this, next), false};
+    }
+
+    std::size_t new_node_level = get_random_level();
+    if (new_node_level > current_level)
+    {
+        for (std::size_t i = current_level + 1; i <= new_node_level; ++i)
+        {
+            update[i] = NIL;
+        }
+        current_level = new_node_level;
+    }
+
+    std::uint32_t slot = allocate_slot(value, new_node_level);
+    for (std::size_t i = 0; i <= new_node_level; ++i)
+    {
+        link(slot, i) = link(update[i], i);
+        link(update[i], i) = slot;
+    }
+
+    num_elements++;
+    update_level_cap();
+    return {iterator(this, slot), true};
+}
+
+template <typename T, typename LevelPolicy>
+bool CompactSkipList<T, LevelPolicy>::contains(const T& value) const
+{
+    std::uint32_t current = find_predecessors(value, nullptr);
+    std::uint32_t next = link(current, 0);
+    return next != NIL && slots[next].value == value;
+}
+
+template <typename T, typename LevelPolicy>
+bool CompactSkipList<T, LevelPolicy>::erase(const T& value)
+{
+    std::uint32_t update[MAX_LEVEL + 1];
+    std::uint32_t current = find_predecessors(value, update);
+
+    std::uint32_t target = link(current, 0);
+    if (target == NIL || !(slots[target].value == value))
+    {
+        return false;
+    }
+
+    std::size_t level = level_of(target);
+    for (std::size_t i = 0; i <= level; ++i)
+    {
+        if (link(update[i], i) == target)
+        {
+            link(update[i], i) = link(target, i);
+        }
+    }
+    free_slot(target);
+    num_elements--;
+
+    while (current_level > 0 && head[current_level] == NIL)
+    {
+        current_level--;
+    }
+    return true;
+}
+
+template <typename T, typename LevelPolicy>
+CompactSkipList<T, LevelPolicy>& CompactSkipList<T, LevelPolicy>::operator=(CompactSkipList&& other) noexcept
+{
+    if (this != &other)
+    {
+        slots = std::move(other.slots);
+        links = std::move(other.links);
+        for (std::size_t i = 0; i <= MAX_LEVEL; ++i)
+        {
+            head[i] = other.head[i];
+            free_towers[i] = other.free_towers[i];
+        }
+        free_slots = other.free_slots;
+        current_level = other.current_level;
+        num_elements = other.num_elements;
+        level_cap = other.level_cap;
+        next_cap_growth = other.next_cap_growth;
+
+        other.clear();
+    }
+    return *this;
+}
+
+template <typename T, typename LevelPolicy>
+CompactSkipList<T, LevelPolicy>& CompactSkipList<T, LevelPolicy>::operator=(const CompactSkipList& other)
+{
+    if (this != &other)
+    {
+        // Move assignment keeps our generator, like in SkipList
+        CompactSkipList temp(other);
+        *this = std::move(temp);
+    }
+    return *this;
+}
+
+template <typename T, typename LevelPolicy>
+bool CompactSkipList<T, LevelPolicy>::operator==(const CompactSkipList& other) const
+{
+    if (num_elements != other.num_elements)
+    {
+        return false;
+    }
+
+    auto it2 = other.cbegin();
+    for (auto it1 = cbegin(); it1 != cend(); ++it1, ++it2)
+    {
+        if (!(*it1 == *it2))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T, typename LevelPolicy>
+bool CompactSkipList<T, LevelPolicy>::operator!=(const CompactSkipList& other) const
+{
+    return !(*this == other);
+}
+
+template <typename T, typename LevelPolicy>
+bool CompactSkipList<T, LevelPolicy>::operator<(const CompactSkipList& other) const
+{
+    auto it1 = cbegin();
+    auto end1 = cend();
+    auto it2 = other.cbegin();
+    auto end2 = other.cend();
+
+    for (; it1 != end1 && it2 != end2; ++it1, ++it2)
+    {
+        if (*it1 < *it2)
+        {
+            return true;
+        }
+        if (*it2 < *it1)
+        {
+            return false;
+        }
+    }
+
+    return (it1 == end1 && it2 != end2);
+}
+
+template <typename T, typename LevelPolicy>
+bool CompactSkipList<T, LevelPolicy>::operator>(const CompactSkipList& other) const
+{
+    return other < *this;
+}
+
+template <typename T, typename LevelPolicy>
+bool CompactSkipList<T, LevelPolicy>::operator<=(const CompactSkipList& other) const
+{
+    return !(*this > other);
+}
+
+template <typename T, typename LevelPolicy>
+bool CompactSkipList<T, LevelPolicy>::operator>=(const CompactSkipList& other) const
+{
+    return !(*this < other);
+}
+
+#endif
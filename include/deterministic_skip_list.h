@@ -0,0 +1,906 @@
+#ifndef DETERMINISTIC_SKIP_LIST_H
+#define DETERMINISTIC_SKIP_LIST_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+// Deterministic 1-2-3 skip list (Munro, Papadakis, Sedgewick). Instead of
+// drawing tower heights, the structure keeps every gap between two adjacent
+// nodes of a level 1, 2 or 3 nodes wide on the level below. This bounds the
+// height by log2(n) + 2 and every insert, erase and lookup by O(log n) steps,
+// not just on average, so there is no unlucky level sequence to cause a slow
+// outlier.
+//
+// Nodes are linked horizontally and vertically: every node has a key, a right
+// and a down pointer. A node above level 0 stands for the group of nodes below
+// it that starts at its down pointer and ends before the down pointer of its
+// right neighbour, and carries the largest key of that group. Every level ends
+// with a node whose key is +infinity, and the top level consists of only that
+// node (head). Level 0 holds the elements.
+//
+// Insert splits every full gap on its way down, erase widens every gap of
+// width 1 by borrowing from or merging with a neighbour, so both finish in a
+// single top-down pass. Only keys above level 0 are rewritten; elements stay in
+// their nodes, so like SkipList only erasing an element invalidates iterators
+// to it.
+template <typename T, typename Allocator = std::allocator<T>>
+class DeterministicSkipList
+{
+    public:
+        using allocator_type = Allocator;
+
+    private:
+        struct Node
+        {
+            // Union so that the +infinity nodes can exist without a value
+            union
+            {
+                T key;
+            };
+
+            Node* right;
+            Node* down;
+            bool infinite;
+
+            Node(Node* _right, Node* _down) : right(_right), down(_down), infinite(true) {}
+            ~Node() {}
+        };
+
+        using value_traits = std::allocator_traits<Allocator>;
+        using node_allocator_type = typename value_traits::template rebind_alloc<Node>;
+        using node_traits = std::allocator_traits<node_allocator_type>;
+
+        // Search paths are at most this long (see the height bound above)
+        static const std::size_t MAX_HEIGHT = 64;
+
+        // Values are constructed with alloc, nodes come from its rebound copy
+        [[no_unique_address]] Allocator alloc;
+        [[no_unique_address]] node_allocator_type node_alloc;
+
+        Node* head;
+
+        std::size_t height;
+        std::size_t num_elements;
+
+        // New +infinity node
+        Node* create_node(Node* right, Node* down);
+        // New level 0 node holding value
+        Node* create_node(const T& value, Node* right);
+        void destroy_node(Node* node);
+        // Frees every node, the head included
+        void destroy_all() noexcept;
+
+        // Copies or moves the key of `from` (possibly +infinity) into `to`
+        void copy_key(Node* to, const Node* from);
+        void move_key(Node* to, Node* from);
+
+        // x < value, with +infinity never less
+        static bool less(const Node* x, const T& value);
+        // x == value, given that x is not less than value
+        static bool matches(const Node* x, const T& value);
+
+        // Node after the last member of x's group on the level below
+        static Node* group_end(const Node* x);
+        // Members of x's group, counted up to limit
+        static std::size_t group_size(const Node* x, std::size_t limit);
+        // Last member of left's group, the left neighbour of left->right->down
+        static Node* last_of_group(const Node* left);
+
+        // Widens x's group to at least 3 nodes. prev is x's left neighbour in
+        // the group of parent (nullptr if x comes first). Returns the node that
+        // covers x's former group afterwards.
+        Node* widen_gap(Node* parent, Node* x, Node* prev);
+
+        // Adds a level on top when the head's group got split
+        void grow();
+        // Drops top levels whose head has a group of a single node
+        void shrink();
+
+        const Node* first_element() const;
+        // Level 0 node equal to value, nullptr if there is none
+        Node* find_node(const T& value) const;
+
+    public:
+        // ==============================
+
+        class const_iterator;
+
+        class iterator
+        {
+            private:
+                Node* node;
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = T*;
+                using reference = T&;
+
+                friend class const_iterator;
+
+                explicit iterator(Node* node_ptr = nullptr) : node(node_ptr) {}
+
+                reference operator*() const
+                {
+                    if (!node)
+                    {
+                        throw std::out_of_range("Dereferencing null iterator.");
+                    }
+                    return node->key;
+                }
+
+                pointer operator->() const
+                {
+                    return &(**this);
+                }
+
+                iterator& operator++()
+                {
+                    if (node)
+                    {
+                        node = node->right;
+                        if (node->infinite)
+                        {
+                            node = nullptr;
+                        }
+                    }
+                    return *this;
+                }
+
+                iterator operator++(int)
+                {
+                    iterator temp = *this;
+                    ++(*this);
+                    return temp;
+                }
+
+                bool operator==(const iterator& other) const { return node == other.node; }
+                bool operator!=(const iterator& other) const { return node != other.node; }
+
+                bool operator==(const const_iterator& other) const { return node == other.node; }
+                bool operator!=(const const_iterator& other) const { return node != other.node; }
+        };
+
+        class const_iterator
+        {
+            friend class iterator;
+            private:
+                const Node* node;
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const T*;
+                using reference = const T&;
+
+                explicit const_iterator(const Node* node_ptr = nullptr) : node(node_ptr) {}
+
+                // transition constructor
+                const_iterator(const iterator& other) : node(other.node) {}
+
+                reference operator*() const
+                {
+                    if (!node)
+                    {
+                        throw std::out_of_range("Dereferencing null iterator.");
+                    }
+                    return node->key;
+                }
+
+                pointer operator->() const
+                {
+                    return &(**this);
+                }
+
+                const_iterator& operator++()
+                {
+                    if (node)
+                    {
+                        node = node->right;
+                        if (node->infinite)
+                        {
+                            node = nullptr;
+                        }
+                    }
+                    return *this;
+                }
+
+                const_iterator operator++(int)
+                {
+                    const_iterator temp = *this;
+                    ++(*this);
+                    return temp;
+                }
+
+                bool operator==(const const_iterator& other) const { return node == other.node; }
+                bool operator!=(const const_iterator& other) const { return node != other.node; }
+
+                bool operator==(const iterator& other) const { return node == other.node; }
+                bool operator!=(const iterator& other) const { return node != other.node; }
+        };
+
+        iterator begin() { return iterator(const_cast<Node*>(first_element())); }
+        const_iterator begin() const { return const_iterator(first_element()); }
+        iterator end() { return iterator(nullptr); }
+        const_iterator end() const { return const_iterator(nullptr); }
+        const_iterator cbegin() const { return const_iterator(first_element()); }
+        const_iterator cend() const { return const_iterator(nullptr); }
+
+        // ======================
+
+        DeterministicSkipList();
+        explicit DeterministicSkipList(const Allocator& allocator);
+        ~DeterministicSkipList();
+
+        DeterministicSkipList(const DeterministicSkipList& other);
+        DeterministicSkipList(const DeterministicSkipList& other, const Allocator& allocator);
+        DeterministicSkipList(DeterministicSkipList&& other) noexcept;
+
+        allocator_type get_allocator() const;
+
+        // Index of the top level; the list is get_current_level() + 1 levels high
+        std::size_t get_current_level() const;
+        std::size_t size() const;
+        bool empty() const;
+
+        // Keeps the bottom +infinity node as the new head, so it never allocates
+        void clear() noexcept;
+
+        // Returns the element equal to value and whether it was inserted
+        std::pair<iterator, bool> insert(const T& value);
+        bool contains(const T& value) const;
+        iterator find(const T& value);
+        const_iterator find(const T& value) const;
+        bool erase(const T& value);
+
+        bool operator==(const DeterministicSkipList& other) const;
+        bool operator!=(const DeterministicSkipList& other) const;
+        DeterministicSkipList& operator=(const DeterministicSkipList& other);
+        DeterministicSkipList& operator=(DeterministicSkipList&& other) noexcept(value_traits::propagate_on_container_move_assignment::value
+                                                                                 || value_traits::is_always_equal::value);
+        bool operator<(const DeterministicSkipList& other) const;
+        bool operator>(const DeterministicSkipList& other) const;
+        bool operator<=(const DeterministicSkipList& other) const;
+        bool operator>=(const DeterministicSkipList& other) const;
+};
+
+// Node helpers
+
+template <typename T, typename Allocator>
+typename DeterministicSkipList<T, Allocator>::Node* DeterministicSkipList<T, Allocator>::create_node(Node* right, Node* down)
+{
+    Node* node = node_traits::allocate(node_alloc, 1);
+    return ::new (static_cast<void*>(node)) Node(right, down);
+}
+
+template <typename T, typename Allocator>
+typename DeterministicSkipList<T, Allocator>::Node* DeterministicSkipList<T, Allocator>::create_node(const T& value, Node* right)
+{
+    Node* node = create_node(right, nullptr);
+    try
+    {
+        value_traits::construct(alloc, std::addressof(node->key), value);
+    }
+    catch (...)
+    {
+        destroy_node(node);
+        throw;
+    }
+    node->infinite = false;
+    return node;
+}
+
+template <typename T, typename Allocator>
+void DeterministicSkipList<T, Allocator>::destroy_node(Node* node)
+{
+    if (!node->infinite)
+    {
+        value_traits::destroy(alloc, std::addressof(node->key));
+    }
+    node->~Node();
+    node_traits::deallocate(node_alloc, node, 1);
+}
+
+template <typename T, typename Allocator>
+void DeterministicSkipList<T, Allocator>::destroy_all() noexcept
+{
+    Node* level = head;
+    while (level != nullptr)
+    {
+        Node* below = level->down;
+        Node* current = level;
+        while (current != nullptr)
+        {
+            Node* next_node = current->right;
+            destroy_node(current);
+            current = next_node;
+        }
+        level = below;
+    }
+    head = nullptr;
+}
+
+template <typename T, typename Allocator>
+void DeterministicSkipList<T, Allocator>::copy_key(Node* to, const Node* from)
+{
+    if (from->infinite)
+    {
+        if (!to->infinite)
+        {
+            value_traits::destroy(alloc, std::addressof(to->key));
+            to->infinite = true;
+        }
+    }
+    else if (to->infinite)
+    {
+        value_traits::construct(alloc, std::addressof(to->key), from->key);
+        to->infinite = false;
+    }
+    else
+    {
+        to->key = from->key;
+    }
+}
+
+template <typename T, typename Allocator>
+void DeterministicSkipList<T, Allocator>::move_key(Node* to, Node* from)
+{
+    if (from->infinite)
+    {
+        if (!to->infinite)
+        {
+            value_traits::destroy(alloc, std::addressof(to->key));
+            to->infinite = true;
+        }
+    }
+    else if (to->infinite)
+    {
+        value_traits::construct(alloc, std::addressof(to->key), std::move(from->key));
+        to->infinite = false;
+    }
+    else
+    {
+        to->key = std::move(from->key);
+    }
+}
+
+template <typename T, typename Allocator>
+bool DeterministicSkipList<T, Allocator>::less(const Node* x, const T& value)
+{
+    return !x->infinite && x->key < value;
+}
+
+template <typename T, typename Allocator>
+bool DeterministicSkipList<T, Allocator>::matches(const Node* x, const T& value)
+{
+    return !x->infinite && !(value < x->key);
+}
+
+template <typename T, typename Allocator>
+typename DeterministicSkipList<T, Allocator>::Node* DeterministicSkipList<T, Allocator>::group_end(const Node* x)
+{
+    return x->right == nullptr ? nullptr : x->right->down;
+}
+
+template <typename T, typename Allocator>
+std::size_t DeterministicSkipList<T, Allocator>::group_size(const Node* x, std::size_t limit)
+{
+    const Node* end = group_end(x);
+    std::size_t count = 0;
+    for (const Node* current = x->down; current != end && count < limit; current = current->right)
+    {
+        ++count;
+    }
+    return count;
+}
+
+template <typename T, typename Allocator>
+typename DeterministicSkipList<T, Allocator>::Node* DeterministicSkipList<T, Allocator>::last_of_group(const Node* left)
+{
+    const Node* end = group_end(left);
+    Node* last = left->down;
+    while (last->right != end)
+    {
+        last = last->right;
+    }
+    return last;
+}
+
+// List
+
+template <typename T, typename Allocator>
+DeterministicSkipList<T, Allocator>::DeterministicSkipList() : DeterministicSkipList(Allocator()) {}
+
+template <typename T, typename Allocator>
+DeterministicSkipList<T, Allocator>::DeterministicSkipList(const Allocator& allocator) :
+    alloc(allocator), node_alloc(allocator), head(nullptr), height(1), num_elements(0)
+{
+    head = create_node(nullptr, nullptr);
+}
+
+template <typename T, typename Allocator>
+DeterministicSkipList<T, Allocator>::DeterministicSkipList(const DeterministicSkipList& other) :
+    DeterministicSkipList(other, value_traits::select_on_container_copy_construction(other.alloc)) {}
+
+template <typename T, typename Allocator>
+DeterministicSkipList<T, Allocator>::DeterministicSkipList(const DeterministicSkipList& other, const Allocator& allocator) :
+    DeterministicSkipList(allocator)
+{
+    for (const T& value : other)
+    {
+        insert(value);
+    }
+}
+
+template <typename T, typename Allocator>
+DeterministicSkipList<T, Allocator>::DeterministicSkipList(DeterministicSkipList&& other) noexcept :
+    alloc(other.alloc), node_alloc(other.node_alloc),
+    head(other.head), height(other.height), num_elements(other.num_elements)
+{
+    other.head = other.create_node(nullptr, nullptr);
+    other.height = 1;
+    other.num_elements = 0;
+}
+
+template <typename T, typename Allocator>
+DeterministicSkipList<T, Allocator>::~DeterministicSkipList()
+{
+    destroy_all();
+}
+
+template <typename T, typename Allocator>
+typename DeterministicSkipList<T, Allocator>::allocator_type DeterministicSkipList<T, Allocator>::get_allocator() const
+{
+    return alloc;
+}
+
+template <typename T, typename Allocator>
+const typename DeterministicSkipList<T, Allocator>::Node* DeterministicSkipList<T, Allocator>::first_element() const
+{
+    const Node* current = head;
+    while (current->down != nullptr)
+    {
+        current = current->down;
+    }
+    return current->infinite ? nullptr : current;
+}
+
+template <typename T, typename Allocator>
+std::size_t DeterministicSkipList<T, Allocator>::get_current_level() const
+{
+    return height - 1;
+}
+
+template <typename T, typename Allocator>
+std::size_t DeterministicSkipList<T, Allocator>::size() const
+{
+    return num_elements;
+}
+
+template <typename T, typename Allocator>
+bool DeterministicSkipList<T, Allocator>::empty() const
+{
+    return num_elements == 0;
+}
+
+template <typename T, typename Allocator>
+void DeterministicSkipList<T, Allocator>::clear() noexcept
+{
+    Node* level = head;
+    Node* bottom = nullptr;
+    while (level != nullptr)
+    {
+        Node* below = level->down;
+        Node* current = level;
+        while (current != nullptr)
+        {
+            Node* next_node = current->right;
+            // The +infinity node of level 0 is the only one without both links
+            if (below == nullptr && next_node == nullptr)
+            {
+                bottom = current;
+            }
+            else
+            {
+                destroy_node(current);
+            }
+            current = next_node;
+        }
+        level = below;
+    }
+
+    head = bottom;
+    height = 1;
+    num_elements = 0;
+}
+
+template <typename T, typename Allocator>
+void DeterministicSkipList<T, Allocator>::grow()
+{
+    if (head->right != nullptr)
+    {
+        head = create_node(nullptr, head);
+        ++height;
+    }
+}
+
+template <typename T, typename Allocator>
+void DeterministicSkipList<T, Allocator>::shrink()
+{
+    while (head->down != nullptr && head->down->right == nullptr)
+    {
+        Node* old_head = head;
+        head = head->down;
+        destroy_node(old_head);
+        --height;
+    }
+}
+
+template <typename T, typename Allocator>
+std::pair<typename DeterministicSkipList<T, Allocator>::iterator, bool> DeterministicSkipList<T, Allocator>::insert(const T& value)
+{
+    // current's left neighbour on its level (nullptr at the start of a level),
+    // and the node whose group current belongs to
+    Node* parent = nullptr;
+    Node* left = nullptr;
+    Node* current = head;
+
+    while (current->down != nullptr)
+    {
+        while (less(current, value))
+        {
+            left = current;
+            current = current->right;
+        }
+
+        // Split a gap of width 3 before descending into it, so there is room
+        // for one more node below
+        Node* end = group_end(current);
+        Node* second = current->down->right;
+        if (second != end && second->right != end && second->right->right != end)
+        {
+            Node* third = second->right;
+            Node* upper = create_node(current->right, third);
+            move_key(upper, current);
+            copy_key(current, second);
+            current->right = upper;
+            if (less(current, value))
+            {
+                left = current;
+                current = upper;
+            }
+        }
+
+        parent = current;
+        left = left == nullptr ? nullptr : last_of_group(left);
+        current = current->down;
+    }
+
+    while (less(current, value))
+    {
+        left = current;
+        current = current->right;
+    }
+
+    if (matches(current, value))
+    {
+        // The descent may still have split the head's group
+        grow();
+        return {iterator(current), false};
+    }
+
+    // Link the new node in front of current. If current starts its group, the
+    // new node takes its place there; in an empty list it becomes the head.
+    Node* node = create_node(value, current);
+    if (left != nullptr)
+    {
+        left->right = node;
+    }
+    if (parent == nullptr)
+    {
+        head = node;
+    }
+    else if (parent->down == current)
+    {
+        parent->down = node;
+    }
+    ++num_elements;
+
+    grow();
+    return {iterator(node), true};
+}
+
+template <typename T, typename Allocator>
+typename DeterministicSkipList<T, Allocator>::Node* DeterministicSkipList<T, Allocator>::find_node(const T& value) const
+{
+    Node* current = head;
+
+    while (true)
+    {
+        while (less(current, value))
+        {
+            current = current->right;
+        }
+        if (current->down == nullptr)
+        {
+            return matches(current, value) ? current : nullptr;
+        }
+        current = current->down;
+    }
+}
+
+template <typename T, typename Allocator>
+bool DeterministicSkipList<T, Allocator>::contains(const T& value) const
+{
+    return find_node(value) != nullptr;
+}
+
+template <typename T, typename Allocator>
+typename DeterministicSkipList<T, Allocator>::iterator DeterministicSkipList<T, Allocator>::find(const T& value)
+{
+    return iterator(find_node(value));
+}
+
+template <typename T, typename Allocator>
+typename DeterministicSkipList<T, Allocator>::const_iterator DeterministicSkipList<T, Allocator>::find(const T& value) const
+{
+    return const_iterator(find_node(value));
+}
+
+template <typename T, typename Allocator>
+typename DeterministicSkipList<T, Allocator>::Node* DeterministicSkipList<T, Allocator>::widen_gap(Node* parent, Node* x, Node* prev)
+{
+    if (group_size(x, 3) >= 3)
+    {
+        return x;
+    }
+
+    if (x->right != group_end(parent))
+    {
+        Node* sibling = x->right;
+        if (group_size(sibling, 3) >= 3)
+        {
+            // Borrow the first node of the right neighbour's group
+            Node* borrowed = sibling->down;
+            sibling->down = borrowed->right;
+            copy_key(x, borrowed);
+        }
+        else
+        {
+            // Merge the right neighbour's group into x's
+            x->right = sibling->right;
+            move_key(x, sibling);
+            destroy_node(sibling);
+        }
+        return x;
+    }
+
+    // x covers the last group of parent, so prev exists
+    if (group_size(prev, 3) >= 3)
+    {
+        // Borrow the last node of the left neighbour's group
+        Node* before_last = prev->down;
+        while (before_last->right->right != x->down)
+        {
+            before_last = before_last->right;
+        }
+        x->down = before_last->right;
+        copy_key(prev, before_last);
+        return x;
+    }
+
+    // Merge x's group into the left neighbour's
+    prev->right = x->right;
+    move_key(prev, x);
+    destroy_node(x);
+    return prev;
+}
+
+template <typename T, typename Allocator>
+bool DeterministicSkipList<T, Allocator>::erase(const T& value)
+{
+    // Nodes above level 0 whose key is the value being erased
+    Node* copies[MAX_HEIGHT];
+    std::size_t copy_count = 0;
+
+    // As in insert(); before_left is left's own left neighbour, which becomes
+    // current's when widen_gap() merges current into left
+    Node* parent = nullptr;
+    Node* left = nullptr;
+    Node* current = head;
+
+    while (true)
+    {
+        Node* before_left = nullptr;
+        while (less(current, value))
+        {
+            before_left = left;
+            left = current;
+            current = current->right;
+        }
+
+        if (current->down == nullptr)
+        {
+            break;
+        }
+
+        if (parent != nullptr)
+        {
+            Node* prev = current == parent->down ? nullptr : left;
+            Node* widened = widen_gap(parent, current, prev);
+            if (widened != current)
+            {
+                left = before_left;
+                current = widened;
+            }
+        }
+        if (matches(current, value))
+        {
+            copies[copy_count++] = current;
+        }
+
+        parent = current;
+        left = left == nullptr ? nullptr : last_of_group(left);
+        current = current->down;
+    }
+
+    if (!matches(current, value))
+    {
+        shrink();
+        return false;
+    }
+
+    // An element exists, so the list is at least 2 levels high and parent is set
+    if (current->right != group_end(parent))
+    {
+        // current is not the largest of its group, so no key above names it
+        if (left != nullptr)
+        {
+            left->right = current->right;
+        }
+        if (parent->down == current)
+        {
+            parent->down = current->right;
+        }
+    }
+    else
+    {
+        // current ends its group, which has at least 2 nodes: left takes over
+        // as the last node and the keys above that named current follow it
+        left->right = current->right;
+        for (std::size_t i = 0; i < copy_count; ++i)
+        {
+            copy_key(copies[i], left);
+        }
+    }
+    destroy_node(current);
+    --num_elements;
+
+    shrink();
+    return true;
+}
+
+template <typename T, typename Allocator>
+DeterministicSkipList<T, Allocator>& DeterministicSkipList<T, Allocator>::operator=(const DeterministicSkipList& other)
+{
+    if (this != &other)
+    {
+        DeterministicSkipList temp(other, value_traits::propagate_on_container_copy_assignment::value ? other.alloc : alloc);
+        std::swap(alloc, temp.alloc);
+        std::swap(node_alloc, temp.node_alloc);
+        std::swap(head, temp.head);
+        std::swap(height, temp.height);
+        std::swap(num_elements, temp.num_elements);
+    }
+    return *this;
+}
+
+template <typename T, typename Allocator>
+DeterministicSkipList<T, Allocator>& DeterministicSkipList<T, Allocator>::operator=(DeterministicSkipList&& other) noexcept(value_traits::propagate_on_container_move_assignment::value
+                                                                                                                           || value_traits::is_always_equal::value)
+{
+    if (this != &other)
+    {
+        clear();
+
+        if (value_traits::propagate_on_container_move_assignment::value || node_alloc == other.node_alloc)
+        {
+            // Our empty head goes to other together with the allocator that owns it
+            if constexpr (value_traits::propagate_on_container_move_assignment::value)
+            {
+                std::swap(alloc, other.alloc);
+                std::swap(node_alloc, other.node_alloc);
+            }
+            std::swap(head, other.head);
+            height = other.height;
+            num_elements = other.num_elements;
+        }
+        else
+        {
+            // Nodes of other belong to a different allocator, so values are copied over
+            for (const T& value : other)
+            {
+                insert(value);
+            }
+            other.clear();
+        }
+
+        other.height = 1;
+        other.num_elements = 0;
+    }
+    return *this;
+}
+
+template <typename T, typename Allocator>
+bool DeterministicSkipList<T, Allocator>::operator==(const DeterministicSkipList& other) const
+{
+    if (num_elements != other.num_elements)
+    {
+        return false;
+    }
+
+    auto it2 = other.cbegin();
+    for (auto it1 = cbegin(); it1 != cend(); ++it1, ++it2)
+    {
+        if (!(*it1 == *it2))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T, typename Allocator>
+bool DeterministicSkipList<T, Allocator>::operator!=(const DeterministicSkipList& other) const
+{
+    return !(*this == other);
+}
+
+template <typename T, typename Allocator>
+bool DeterministicSkipList<T, Allocator>::operator<(const DeterministicSkipList& other) const
+{
+    auto it1 = cbegin();
+    auto end1 = cend();
+    auto it2 = other.cbegin();
+    auto end2 = other.cend();
+
+    for (; it1 != end1 && it2 != end2; ++it1, ++it2)
+    {
+        if (*it1 < *it2)
+        {
+            return true;
+        }
+        if (*it2 < *it1)
+        {
+            return false;
+        }
+    }
+
+    return (it1 == end1 && it2 != end2);
+}
+
+template <typename T, typename Allocator>
+bool DeterministicSkipList<T, Allocator>::operator>(const DeterministicSkipList& other) const
+{
+    return other < *this;
+}
+
+template <typename T, typename Allocator>
+bool DeterministicSkipList<T, Allocator>::operator<=(const DeterministicSkipList& other) const
+{
+    return !(*this > other);
+}
+
+template <typename T, typename Allocator>
+bool DeterministicSkipList<T, Allocator>::operator>=(const DeterministicSkipList& other) const
+{
+    return !(*this < other);
+}
+
+#endif
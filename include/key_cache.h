@@ -0,0 +1,95 @@
+#ifndef KEY_CACHE_H
+#define KEY_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Key cache policies for SkipList links.
+// With caching enabled every forward link stores a key of its successor next to
+// the pointer, so the search only touches a node when it actually moves right
+// (or when a prefix key cannot decide the comparison).
+//
+// A policy provides:
+//     enabled                  - whether links carry a key at all
+//     exact                    - equal cached keys mean equal values
+//     heterogeneous            - make() also takes the other key types it accepts,
+//                                for lookups through a transparent comparator
+//     key_type                 - what is stored in a link
+//     make(value)              - the cached key of a value
+//     compare(cached, probe)   - negative/positive if the keys already order
+//                                the values, 0 if the values must be compared
+//
+// Cached keys must order the same way as operator< on the values.
+
+// Links hold only the pointer (default)
+struct NoKeyCache
+{
+    static constexpr bool enabled = false;
+    static constexpr bool exact = false;
+    static constexpr bool heterogeneous = false;
+
+    struct key_type {};
+
+    template <typename T>
+    static key_type make(const T&) { return {}; }
+
+    static int compare(const key_type&, const key_type&) { return 0; }
+};
+
+// Links hold a full copy of the successor's value. Meant for small keys such as int or double.
+template <typename T>
+struct CopyKeyCache
+{
+    static constexpr bool enabled = true;
+    static constexpr bool exact = true;
+    static constexpr bool heterogeneous = false;
+
+    using key_type = T;
+
+    static key_type make(const T& value) { return value; }
+
+    static int compare(const key_type& cached, const key_type& probe)
+    {
+        if (cached < probe)
+        {
+            return -1;
+        }
+        if (probe < cached)
+        {
+            return 1;
+        }
+        return 0;
+    }
+};
+
+// Links hold the first 8 bytes of the successor's string as a big-endian integer,
+// zero-padded. A smaller prefix means a smaller string; equal prefixes are undecided.
+// Anything convertible to std::string_view gets the same key as the equal string.
+struct StringPrefixKeyCache
+{
+    static constexpr bool enabled = true;
+    static constexpr bool exact = false;
+    static constexpr bool heterogeneous = true;
+
+    using key_type = std::uint64_t;
+
+    static key_type make(std::string_view value)
+    {
+        key_type key = 0;
+        for (std::size_t i = 0; i < sizeof(key_type); ++i)
+        {
+            unsigned char byte = i < value.size() ? static_cast<unsigned char>(value[i]) : 0;
+            key = (key << 8) | byte;
+        }
+        return key;
+    }
+
+    static int compare(key_type cached, key_type probe)
+    {
+        return cached < probe ? -1 : (probe < cached ? 1 : 0);
+    }
+};
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef LEVEL_GENERATOR_H
+#define LEVEL_GENERATOR_H
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <random>
+
+// Tower heights for skip lists: a height of at least k has probability P^k.
+// Every draw is one 64-bit word from splitmix64. For P = 1/2, 1/4, 1/8, ... the
+// height is the number of trailing zero bits divided by log2(1/P), so there is
+// no loop; any other P (such as 1/e) takes floor(log(u) / log(P)) of a uniform u.
+template <double P = 0.5>
+class LevelGenerator
+{
+    static_assert(P > 0.0 && P < 1.0, "promotion probability must lie in (0, 1)");
+
+    private:
+        // log2(1/P) if P is a power of two, 0 otherwise
+        static constexpr unsigned bits_per_level()
+        {
+            double power = 0.5;
+            for (unsigned bits = 1; bits < 64; ++bits, power /= 2)
+            {
+                if (power == P)
+                {
+                    return bits;
+                }
+            }
+            return 0;
+        }
+
+        static constexpr unsigned BITS_PER_LEVEL = bits_per_level();
+
+        std::uint64_t state;
+
+        std::uint64_t next();
+
+    public:
+        explicit LevelGenerator(std::uint64_t seed = 0) : state(seed) {}
+
+        // Height in [0, max_level]; all draws beyond max_level are folded into max_level
+        std::size_t operator()(std::size_t max_level);
+
+        // Probability that operator()(max_level) returns level
+        static double probability(std::size_t level, std::size_t max_level);
+};
+
+// Seed from std::random_device for lists that are not given one
+inline std::uint64_t random_level_seed()
+{
+    std::random_device device;
+    return (static_cast<std::uint64_t>(device()) << 32) ^ device();
+}
+
+// p = 1/e minimises the expected search cost per element
+inline constexpr double INVERSE_E = 1.0 / std::numbers::e;
+
+// Tower shape of a SkipList: promotion probability P and hard cap MaxLevel.
+// The search buffers are sized by MaxLevel at compile time; the levels in use
+// grow with the element count up to MaxLevel.
+template <double P = 0.5, std::size_t MaxLevel = 32>
+struct LevelPolicy
+{
+    static_assert(MaxLevel < 256, "node levels are stored in one byte");
+
+    static constexpr double probability = P;
+    static constexpr std::size_t max_level = MaxLevel;
+
+    using generator_type = LevelGenerator<P>;
+};
+
+template <double P>
+std::uint64_t LevelGenerator<P>::next()
+{
+    std::uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+template <double P>
+std::size_t LevelGenerator<P>::operator()(std::size_t max_level)
+{
+    std::size_t level;
+    if constexpr (BITS_PER_LEVEL != 0)
+    {
+        // The top bit bounds the count for a zero word
+        level = static_cast<std::size_t>(std::countr_zero(next() | (std::uint64_t(1) << 63))) / BITS_PER_LEVEL;
+    }
+    else
+    {
+        // Uniform in (0, 1] from the top 53 bits
+        double u = static_cast<double>((next() >> 11) + 1) * 0x1.0p-53;
+        level = static_cast<std::size_t>(std::log(u) / std::log(P));
+    }
+    return level < max_level ? level : max_level;
+}
+
+template <double P>
+double LevelGenerator<P>::probability(std::size_t level, std::size_t max_level)
+{
+    if (level > max_level)
+    {
+        return 0.0;
+    }
+
+    double reach = 1.0;
+    for (std::size_t i = 0; i < level; ++i)
+    {
+        reach *= P;
+    }
+    return level < max_level ? reach * (1.0 - P) : reach;
+}
+
+#endif
@@ -2,48 +2,157 @@
 #define NODE_H
 
 #include <cstddef>
-#include <vector>
-#include <memory>
+#include <cstdint>
+#include <new>
+#include <type_traits>
 
-template <typename T>
-struct Node 
+#include "key_cache.h"
+
+// Node keeps the value and its forward pointers in a single allocation:
+//
+//     [ value | level | link[0] ... link[level] ]
+//
+// The tower is sized to the node's level, so the allocation is exactly
+// allocation_size(level) bytes. Nodes are only created through SkipList, which
+// places them into allocator storage and constructs/destroys the value itself.
+// Every link is a forward pointer plus, depending on KeyCache, a cached key of
+// the node it points to (see key_cache.h).
+template <typename T, typename KeyCache = NoKeyCache>
+struct Node;
+
+// One tower entry. With NoKeyCache the key is empty and takes no space.
+template <typename T, typename KeyCache>
+struct NodeLink
+{
+    Node<T, KeyCache>* next;
+    [[no_unique_address]] typename KeyCache::key_type key;
+};
+
+template <typename T, typename KeyCache>
+struct Node
 {
 private:
-    T value;
+    using Link = NodeLink<T, KeyCache>;
+    using key_type = typename KeyCache::key_type;
+
+    static_assert(std::is_trivially_copyable_v<key_type>, "cached keys must be trivially copyable");
+
+    // Union so that the head node can exist without a value
+    union
+    {
+        T value;
+    };
+
+    // Offset of the tower from the beginning of the node
+    static constexpr std::size_t tower_offset =
+        (sizeof(T) + sizeof(std::uint8_t) + alignof(Link) - 1) / alignof(Link) * alignof(Link);
+
+    Link* tower();
+    const Link* tower() const;
 
 public:
-    std::size_t level;
-    std::vector<std::shared_ptr<Node<T>>> next;
+    std::uint8_t level;
+
+    // Links are set to nullptr, value stays uninitialized
+    explicit Node(std::size_t _level);
 
+    // Value is destroyed by the owning SkipList
+    ~Node() {}
 
-    Node(const T& val, std::size_t level);
-            
-    // Dummy node constructor (for example - head)
-    Node(std::size_t _level);
+    Node(const Node&) = delete;
+    Node& operator=(const Node&) = delete;
 
-    ~Node() = default;
+    // Bytes needed for a node with towers from 0 to level
+    static constexpr std::size_t allocation_size(std::size_t level);
+
+    // Forward pointer at level i
+    Node*& next(std::size_t i);
+    Node* next(std::size_t i) const;
+
+    // Cached key of next(i)
+    key_type& key(std::size_t i);
+    const key_type& key(std::size_t i) const;
 
-    // 
     T& getValue();
     const T& getValue() const;
 };
 
-template <typename T>
-Node<T>::Node(const T& val, std::size_t lvl) : value(val), level(lvl), next(level + 1, nullptr) {}
+template <typename T, typename KeyCache>
+Node<T, KeyCache>::Node(std::size_t _lvl) : level(static_cast<std::uint8_t>(_lvl))
+{
+    Link* links = tower();
+    for (std::size_t i = 0; i <= _lvl; ++i)
+    {
+        ::new (static_cast<void*>(links + i)) Link{nullptr, key_type()};
+    }
+}
+
+template <typename T, typename KeyCache>
+constexpr std::size_t Node<T, KeyCache>::allocation_size(std::size_t level)
+{
+    std::size_t bytes = tower_offset + (level + 1) * sizeof(Link);
+    return (bytes + alignof(Node) - 1) / alignof(Node) * alignof(Node);
+}
+
+template <typename T, typename KeyCache>
+typename Node<T, KeyCache>::Link* Node<T, KeyCache>::tower()
+{
+    return reinterpret_cast<Link*>(reinterpret_cast<unsigned char*>(this) + tower_offset);
+}
+
+template <typename T, typename KeyCache>
+const typename Node<T, KeyCache>::Link* Node<T, KeyCache>::tower() const
+{
+    return reinterpret_cast<const Link*>(reinterpret_cast<const unsigned char*>(this) + tower_offset);
+}
+
+template <typename T, typename KeyCache>
+Node<T, KeyCache>*& Node<T, KeyCache>::next(std::size_t i)
+{
+    return tower()[i].next;
+}
 
-template <typename T> 
-Node<T>::Node(std::size_t _lvl) : level(_lvl), next(_lvl + 1, nullptr) {};
+template <typename T, typename KeyCache>
+Node<T, KeyCache>* Node<T, KeyCache>::next(std::size_t i) const
+{
+    return tower()[i].next;
+}
 
-template <typename T>
-T& Node<T>::getValue() 
+template <typename T, typename KeyCache>
+typename Node<T, KeyCache>::key_type& Node<T, KeyCache>::key(std::size_t i)
+{
+    return tower()[i].key;
+}
+
+template <typename T, typename KeyCache>
+const typename Node<T, KeyCache>::key_type& Node<T, KeyCache>::key(std::size_t i) const
+{
+    return tower()[i].key;
+}
+
+template <typename T, typename KeyCache>
+T& Node<T, KeyCache>::getValue()
 {
     return value;
 }
 
-template <typename T>
-const T& Node<T>::getValue() const
+template <typename T, typename KeyCache>
+const T& Node<T, KeyCache>::getValue() const
 {
     return value;
 }
 
-#endif
\ No newline at end of file
+// Allocation unit for nodes. Allocators are rebound to NodeChunk and asked
+// for NodeChunk::count(level) elements, so every node starts suitably aligned.
+template <typename T, typename KeyCache = NoKeyCache>
+struct alignas(Node<T, KeyCache>) alignas(NodeLink<T, KeyCache>) NodeChunk
+{
+    unsigned char bytes[1];
+
+    static constexpr std::size_t count(std::size_t level)
+    {
+        return (Node<T, KeyCache>::allocation_size(level) + sizeof(NodeChunk) - 1) / sizeof(NodeChunk);
+    }
+};
+
+#endif
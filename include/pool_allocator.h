@@ -0,0 +1,331 @@
+#ifndef POOL_ALLOCATOR_H
+#define POOL_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+// Pool of fixed-size blocks for skip list nodes.
+// Requests are rounded up to GRANULE bytes and served from one free list per
+// block size. New blocks are carved from large slabs, so a node costs exactly
+// its rounded size with no per-block header. Memory goes back to the system
+// only when the pool is released or destroyed.
+//
+// With PageMode::huge slabs are 2 MiB and mapped with MAP_HUGETLB, or failing that
+// with madvise(MADV_HUGEPAGE), so that a large list needs few TLB entries.
+// Without huge page support they silently come from operator new.
+//
+// A pool is not thread-safe. Every list gets its own pool unless one is shared explicitly.
+class NodePool
+{
+    public:
+        static const std::size_t GRANULE = 8;
+        static const std::size_t MAX_POOLED_SIZE = 512; // larger blocks go straight to operator new
+        static const std::size_t SLAB_SIZE = 64 * 1024;
+        static const std::size_t HUGE_SLAB_SIZE = 2 * 1024 * 1024;
+
+        enum class PageMode
+        {
+            normal,
+            huge
+        };
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        // How a slab was obtained, and so how it is given back
+        enum class SlabSource
+        {
+            heap,
+            hugetlb,     // explicit huge pages
+            transparent  // mapping advised for transparent huge pages
+        };
+
+        struct Slab
+        {
+            void* memory;
+            std::size_t size;
+            SlabSource source;
+        };
+
+        static const std::size_t SIZE_CLASSES = MAX_POOLED_SIZE / GRANULE;
+
+        PageMode page_mode;
+        FreeBlock* free_lists[SIZE_CLASSES];
+        std::vector<Slab> slabs;
+
+        // Unused tail of the newest slab
+        unsigned char* slab_cursor;
+        unsigned char* slab_end;
+
+        // Outstanding blocks from slabs and from operator new
+        std::size_t pooled_blocks;
+        std::size_t large_blocks;
+
+        static std::size_t size_class(std::size_t bytes);
+        void* carve(std::size_t block_size);
+
+        Slab map_slab();
+        static void unmap_slab(const Slab& slab) noexcept;
+
+    public:
+        explicit NodePool(PageMode mode = PageMode::normal);
+        ~NodePool();
+
+        NodePool(const NodePool&) = delete;
+        NodePool& operator=(const NodePool&) = delete;
+
+        void* allocate(std::size_t bytes, std::size_t alignment);
+        void deallocate(void* p, std::size_t bytes, std::size_t alignment) noexcept;
+
+        // Returns every slab to the system at once. All pooled blocks become invalid.
+        void release() noexcept;
+
+        // True if exactly `blocks` blocks are outstanding and all of them live in slabs,
+        // i.e. a caller owning that many blocks may release() the whole pool
+        bool holds_only(std::size_t blocks) const;
+
+        std::size_t slab_count() const;
+
+        // Slabs actually backed by huge pages (explicit or transparent)
+        std::size_t huge_slab_count() const;
+
+        PageMode get_page_mode() const;
+};
+
+inline NodePool::NodePool(PageMode mode) : 
+    page_mode(mode), free_lists{}, slab_cursor(nullptr), slab_end(nullptr), pooled_blocks(0), large_blocks(0) {}
+
+inline NodePool::~NodePool()
+{
+    release();
+}
+
+inline std::size_t NodePool::size_class(std::size_t bytes)
+{
+    return (bytes + GRANULE - 1) / GRANULE - 1;
+}
+
+inline void* NodePool::carve(std::size_t block_size)
+{
+    if (static_cast<std::size_t>(slab_end - slab_cursor) < block_size)
+    {
+        // The remainder of the old slab is abandoned; it is smaller than any node
+        // that did not fit, so at most MAX_POOLED_SIZE bytes per slab are lost.
+        slabs.reserve(slabs.size() + 1);
+        Slab slab = map_slab();
+        slabs.push_back(slab);
+        slab_cursor = static_cast<unsigned char*>(slab.memory);
+        slab_end = slab_cursor + slab.size;
+    }
+
+    void* block = slab_cursor;
+    slab_cursor += block_size;
+    return block;
+}
+
+inline NodePool::Slab NodePool::map_slab()
+{
+#if defined(__linux__)
+    if (page_mode == PageMode::huge)
+    {
+#if defined(MAP_HUGETLB)
+        void* memory = ::mmap(nullptr, HUGE_SLAB_SIZE, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (memory != MAP_FAILED)
+        {
+            return Slab{memory, HUGE_SLAB_SIZE, SlabSource::hugetlb};
+        }
+#endif
+#if defined(MADV_HUGEPAGE)
+        // No reserved huge pages: map twice the size and keep a 2 MiB aligned
+        // window, which the kernel can back with a transparent huge page
+        void* mapping = ::mmap(nullptr, 2 * HUGE_SLAB_SIZE, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapping != MAP_FAILED)
+        {
+            unsigned char* start = static_cast<unsigned char*>(mapping);
+            unsigned char* aligned = reinterpret_cast<unsigned char*>(
+                (reinterpret_cast<std::uintptr_t>(start) + HUGE_SLAB_SIZE - 1) & ~(std::uintptr_t(HUGE_SLAB_SIZE) - 1));
+            unsigned char* end = start + 2 * HUGE_SLAB_SIZE;
+
+            if (aligned != start)
+            {
+                ::munmap(start, static_cast<std::size_t>(aligned - start));
+            }
+            if (aligned + HUGE_SLAB_SIZE != end)
+            {
+                ::munmap(aligned + HUGE_SLAB_SIZE, static_cast<std::size_t>(end - aligned - HUGE_SLAB_SIZE));
+            }
+
+            if (::madvise(aligned, HUGE_SLAB_SIZE, MADV_HUGEPAGE) == 0)
+            {
+                return Slab{aligned, HUGE_SLAB_SIZE, SlabSource::transparent};
+            }
+            ::munmap(aligned, HUGE_SLAB_SIZE);
+        }
+#endif
+    }
+#endif
+    return Slab{::operator new(SLAB_SIZE), SLAB_SIZE, SlabSource::heap};
+}
+
+inline void NodePool::unmap_slab(const Slab& slab) noexcept
+{
+    if (slab.source == SlabSource::heap)
+    {
+        ::operator delete(slab.memory);
+        return;
+    }
+#if defined(__linux__)
+    ::munmap(slab.memory, slab.size);
+#endif
+}
+
+inline void* NodePool::allocate(std::size_t bytes, std::size_t alignment)
+{
+    if (bytes == 0 || bytes > MAX_POOLED_SIZE || alignment > GRANULE)
+    {
+        void* large = ::operator new(bytes, std::align_val_t(alignment));
+        ++large_blocks;
+        return large;
+    }
+
+    std::size_t index = size_class(bytes);
+    FreeBlock* block = free_lists[index];
+
+    if (block != nullptr)
+    {
+        free_lists[index] = block->next;
+        ++pooled_blocks;
+        return block;
+    }
+
+    void* fresh = carve((index + 1) * GRANULE);
+    ++pooled_blocks;
+    return fresh;
+}
+
+inline void NodePool::deallocate(void* p, std::size_t bytes, std::size_t alignment) noexcept
+{
+    if (bytes == 0 || bytes > MAX_POOLED_SIZE || alignment > GRANULE)
+    {
+        ::operator delete(p, std::align_val_t(alignment));
+        --large_blocks;
+        return;
+    }
+
+    --pooled_blocks;
+    std::size_t index = size_class(bytes);
+    FreeBlock* block = ::new (p) FreeBlock{free_lists[index]};
+    free_lists[index] = block;
+}
+
+inline void NodePool::release() noexcept
+{
+    for (const Slab& slab : slabs)
+    {
+        unmap_slab(slab);
+    }
+    slabs.clear();
+
+    for (FreeBlock*& list : free_lists)
+    {
+        list = nullptr;
+    }
+    slab_cursor = nullptr;
+    slab_end = nullptr;
+    pooled_blocks = 0;
+}
+
+inline bool NodePool::holds_only(std::size_t blocks) const
+{
+    return large_blocks == 0 && pooled_blocks == blocks;
+}
+
+inline std::size_t NodePool::slab_count() const
+{
+    return slabs.size();
+}
+
+inline std::size_t NodePool::huge_slab_count() const
+{
+    std::size_t count = 0;
+    for (const Slab& slab : slabs)
+    {
+        count += slab.source != SlabSource::heap;
+    }
+    return count;
+}
+
+inline NodePool::PageMode NodePool::get_page_mode() const
+{
+    return page_mode;
+}
+
+// Standard allocator on top of a shared NodePool.
+// Copies and rebinds share the pool. A copied container gets a pool of its own
+// with the same page mode, so independent lists never share a pool by accident.
+template <typename T>
+class PoolAllocator
+{
+    private:
+        template <typename U>
+        friend class PoolAllocator;
+
+        std::shared_ptr<NodePool> pool;
+
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        using is_always_equal = std::false_type;
+
+        PoolAllocator() : pool(std::make_shared<NodePool>()) {}
+
+        explicit PoolAllocator(NodePool::PageMode mode) : pool(std::make_shared<NodePool>(mode)) {}
+
+        explicit PoolAllocator(std::shared_ptr<NodePool> shared_pool) : pool(std::move(shared_pool)) {}
+
+        template <typename U>
+        PoolAllocator(const PoolAllocator<U>& other) noexcept : pool(other.pool) {}
+
+        T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(pool->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            pool->deallocate(p, n * sizeof(T), alignof(T));
+        }
+
+        PoolAllocator select_on_container_copy_construction() const
+        {
+            return PoolAllocator(pool->get_page_mode());
+        }
+
+        NodePool& get_pool() const
+        {
+            return *pool;
+        }
+
+        template <typename U>
+        bool operator==(const PoolAllocator<U>& other) const { return pool == other.pool; }
+
+        template <typename U>
+        bool operator!=(const PoolAllocator<U>& other) const { return pool != other.pool; }
+};
+
+#endif
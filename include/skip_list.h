@@ -1,26 +1,150 @@
 #ifndef SKIP_LIST_H
 #define SKIP_LIST_H
 
+#include <algorithm>
+#include <cassert>
+#include <iterator>
 #include <vector>
+#include <cstdint>
 #include <memory>
+#include <memory_resource>
 #include <random>
-#include <iostream>
+#include <thread>
+#include <functional>
+#include <exception>
+#include <type_traits>
 
+#include "key_cache.h"
+#include "level_generator.h"
 #include "node.h"
 
-template <typename T>
+// Elements are kept in the order of Compare. Two elements are equivalent when neither
+// compares less than the other; equivalence is all the list ever checks.
+// The first parameters follow std::set (T, Compare, Allocator), the list's own policies come after.
+template <typename T, typename Compare = std::less<>, typename Allocator = std::allocator<T>, typename KeyCache = NoKeyCache,
+          typename LevelPolicy = ::LevelPolicy<>>
 class SkipList 
 {
+    public:
+        using allocator_type = Allocator;
+        using key_compare = Compare;
+
     private:
-        static const std::size_t MAX_LEVEL = 16; 
-        std::unique_ptr<Node<T>> head;
+        using value_traits = std::allocator_traits<Allocator>;
+        using node_allocator_type = typename value_traits::template rebind_alloc<NodeChunk<T, KeyCache>>;
+        using node_traits = std::allocator_traits<node_allocator_type>;
+        using cached_key_type = typename KeyCache::key_type;
+
+        static_assert(!KeyCache::enabled || std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::less<T>>,
+                      "cached keys order values by operator<, so a key cache needs std::less");
+
+        static const std::size_t MAX_LEVEL = LevelPolicy::max_level; 
+
+        // Whether Compare orders T against other key types (Compare::is_transparent)
+        static constexpr bool transparent = requires { typename Compare::is_transparent; };
+
+        // Values are constructed with alloc, node storage comes from its rebound copy
+        [[no_unique_address]] Allocator alloc;
+        [[no_unique_address]] node_allocator_type node_alloc;
+        [[no_unique_address]] Compare comp;
+
+        Node<T, KeyCache>* head;
 
         std::size_t current_level;
         std::size_t num_elements;
 
-        std::mt19937 rng;
-        std::uniform_real_distribution<> dis;
+        // New levels are drawn up to level_cap, which grows by one whenever num_elements
+        // reaches next_cap_growth = (1/p)^level_cap, so it stays near log_{1/p}(n) + 1.
+        // The head tower is only as tall as the highest cap reached.
+        std::size_t level_cap;
+        double next_cap_growth;
+
+        // Everything allocated from node_alloc besides the links between nodes
+        struct NodeStorage
+        {
+            // Nodes kept for future inserts, one list per level chained through next(0)
+            Node<T, KeyCache>* spare_nodes[MAX_LEVEL + 1] = {};
+            std::size_t spare_count = 0;
+            std::size_t spare_bytes = 0;
+
+            // Block written by compact(). Its nodes are never freed one by one:
+            // erased ones go to the spare lists, the block goes when none is in use.
+            NodeChunk<T, KeyCache>* block = nullptr;
+            std::size_t block_chunks = 0;
+            std::size_t block_nodes_in_use = 0;
+
+            // Outstanding allocations (head, nodes, spares, block) and their size
+            std::size_t allocations = 0;
+            std::size_t bytes = 0;
+        };
+
+        NodeStorage storage;
+
+        // Erased nodes are kept as spares while spare storage stays within this many bytes
+        std::size_t recycle_limit;
+
+        // Every list draws its levels from its own generator
+        typename LevelPolicy::generator_type level_generator;
         std::size_t get_random_level();
+        static std::uint64_t random_seed();
+
+        // Search steps. probe is KeyCache::make(key); with a key cache the
+        // successor node is only touched when its cached key cannot decide.
+        // A key of another type than T skips the cache unless the policy is heterogeneous.
+        template <typename K>
+        static constexpr bool caches_key = KeyCache::enabled
+            && (std::is_same_v<K, T> || (KeyCache::heterogeneous && requires(const K& key) { KeyCache::make(key); }));
+        template <typename K>
+        bool goes_right(const Node<T, KeyCache>* current, std::size_t i, const cached_key_type& probe, const K& key) const;
+        template <typename K>
+        bool next_matches(const Node<T, KeyCache>* current, const cached_key_type& probe, const K& key) const;
+        template <typename K>
+        static cached_key_type make_probe(const K& key);
+
+        // Probability that get_random_level() returns level while draws are capped at cap
+        static double level_probability(std::size_t level, std::size_t cap);
+
+        // Node storage. Every node is a single allocation of NodeChunk<T, KeyCache>::count(level) chunks
+        static std::size_t node_bytes(std::size_t level);
+        Node<T, KeyCache>* allocate_node(std::size_t level);
+        void deallocate_node(Node<T, KeyCache>* node);
+
+        void push_spare_node(Node<T, KeyCache>* node);
+        Node<T, KeyCache>* pop_spare_node(std::size_t level);
+        void release_spare_nodes();
+        bool in_block(const Node<T, KeyCache>* node) const;
+        void release_block();
+
+        Node<T, KeyCache>* create_head();
+        void destroy_head();
+        void grow_head(std::size_t level);
+        void reset_level_cap();
+
+        template <typename... Args>
+        Node<T, KeyCache>* create_node(std::size_t level, Args&&... args);
+        void destroy_node(Node<T, KeyCache>* node);
+        // Height node is linked at, given the next node expected on every level up to top
+        // (the level lists walked so far). Moves expected past node on its levels.
+        static std::size_t linked_height(const Node<T, KeyCache>** expected, std::size_t top, const Node<T, KeyCache>* node);
+        // Appends copies of other's nodes with the heights they are linked at, in one pass.
+        // The list must be empty.
+        void copy_nodes(const SkipList& other);
+        // Appends the elements of a sorted range, keeping the last node of every level.
+        // The list must be empty.
+        template <typename InputIt>
+        void append_sorted(InputIt first, InputIt last);
+
+        // Makes room for a node of the given level above current_level: grows the head if
+        // needed and points update[] at the head on the new levels
+        void raise_current_level(std::size_t level, Node<T, KeyCache>** update);
+        // Raises level_cap once num_elements reaches the next threshold
+        void update_level_cap();
+
+        // Batches of insert_range() at least this long per thread are sorted in parallel
+        static const std::size_t PARALLEL_SORT_CHUNK = 1 << 16;
+        void sort_batch(std::vector<T, Allocator>& batch) const;
+        bool release_storage();
+        void destroy_values() noexcept;
 
     public:
         // ==============================
@@ -30,7 +154,7 @@ class SkipList
         class iterator
         {
             private:
-                Node<T>* current_node;
+                Node<T, KeyCache>* current_node;
 
             public: 
                 using iterator_category = std::forward_iterator_tag; // SkipList only goes forward
@@ -41,7 +165,7 @@ class SkipList
 
                 friend class const_iterator;
 
-                explicit iterator(Node<T>* node_ptr = nullptr) : current_node(node_ptr) {}
+                explicit iterator(Node<T, KeyCache>* node_ptr = nullptr) : current_node(node_ptr) {}
 
                 // Dereferncing operator overload 
                 reference operator*() const
@@ -68,7 +192,7 @@ class SkipList
                 {
                     if (current_node)
                     {
-                        current_node = current_node->next[0].get();
+                        current_node = current_node->next(0);
                     }
                     return *this;
                 }
@@ -93,7 +217,7 @@ class SkipList
         {
             friend class iterator;
             private:
-                const Node<T>* current_node;
+                const Node<T, KeyCache>* current_node;
             
             public:
                 using iterator_category = std::forward_iterator_tag;
@@ -102,10 +226,10 @@ class SkipList
                 using pointer = const T*; 
                 using reference = const T&;
 
-                explicit const_iterator(const Node<T>* node_ptr) : current_node(node_ptr) {}
+                explicit const_iterator(const Node<T, KeyCache>* node_ptr) : current_node(node_ptr) {}
                 
                 // transition constructor
-                const_iterator(const typename SkipList<T>::iterator& other) : current_node(other.current_node) {}
+                const_iterator(const iterator& other) : current_node(other.current_node) {}
 
                 // Dereferncing operator overload 
                 reference operator*()
@@ -132,7 +256,7 @@ class SkipList
                 {
                     if (current_node) 
                     {
-                        current_node = current_node->next[0].get();
+                        current_node = current_node->next(0);
                     }
                     return *this; 
                 }
@@ -155,12 +279,12 @@ class SkipList
 
         iterator begin()
         {
-            return iterator(head->next[0].get());
+            return iterator(head->next(0));
         }
 
         const_iterator begin() const
         {
-            return const_iterator(head->next[0].get());
+            return const_iterator(head->next(0));
         }
 
         iterator end()
@@ -175,7 +299,7 @@ class SkipList
 
         const_iterator cbegin() const
         {
-            return const_iterator(head->next[0].get());
+            return const_iterator(head->next(0));
         }
 
         const_iterator cend() const
@@ -186,380 +310,1655 @@ class SkipList
         // ======================
 
         SkipList();
-        ~SkipList() = default;
+        explicit SkipList(const Allocator& allocator);
+        // Seeds the level generator, so that the same inserts always build the same towers
+        explicit SkipList(std::uint64_t seed, const Allocator& allocator = Allocator());
+        explicit SkipList(const Compare& compare, const Allocator& allocator = Allocator());
+        SkipList(std::uint64_t seed, const Compare& compare, const Allocator& allocator = Allocator());
+        // Builds the list from a range sorted in ascending order in O(n), without searching.
+        // Elements not greater than the previous one are skipped, so duplicates may be present;
+        // an out-of-order element fails an assertion in debug builds.
+        template <std::input_iterator InputIt>
+        SkipList(InputIt first, InputIt last, const Allocator& allocator = Allocator());
+        template <std::input_iterator InputIt>
+        SkipList(InputIt first, InputIt last, const Compare& compare, const Allocator& allocator = Allocator());
+        ~SkipList();
 
         // Additive constructors
         SkipList(const SkipList& other);
+        SkipList(const SkipList& other, const Allocator& allocator);
         SkipList(SkipList&& other) noexcept;
 
+        allocator_type get_allocator() const;
+        key_compare key_comp() const;
+
         // Init checking
         std::size_t get_current_level() const;
         std::size_t size() const;
         bool empty() const;
 
+        // Destroys all elements one by one along level 0, never recursively
+        void clear() noexcept;
+
+        // Replaces the contents with a sorted range, like the range constructor
+        template <std::input_iterator InputIt>
+        void assign(InputIt first, InputIt last);
+
+        // Number of elements the list can hold without allocating nodes
+        std::size_t capacity() const;
+
+        // Pre-allocates nodes for n elements, split over levels by the expected level distribution,
+        // and the head levels n elements reach. Inserts take a spare node of their level while one is left.
+        void reserve(std::size_t n);
+
+        // Frees all spare nodes
+        void shrink_to_fit() noexcept;
+
+        // Bytes allocated for the head, the nodes and the spare nodes
+        std::size_t memory_usage() const;
+
+        // Nodes of one tower height. Every height has its own node size and so its own
+        // size class in allocators such as NodePool.
+        struct HeightStats
+        {
+            std::size_t nodes = 0;       // nodes holding elements, by the height they are linked at
+            std::size_t spare_nodes = 0; // nodes kept by reserve() or recycling
+            std::size_t node_bytes = 0;  // allocation size of one node
+        };
+
+        // One entry per height 0..MAX_LEVEL
+        std::vector<HeightStats> height_stats() const;
+
+        // Erased nodes are kept for reuse by inserts of the same level while the spare nodes
+        // take at most limit bytes. 0 (the default) hands every erased node back to the allocator.
+        // A lower limit applies to later erasures; shrink_to_fit() drops what is already kept.
+        void set_recycle_limit(std::size_t limit);
+        std::size_t get_recycle_limit() const;
+
+        // Moves all elements into a single block laid out in key order, so that
+        // iteration and the lower levels of a search walk memory sequentially.
+        // Spare nodes are released. Every node keeps the height it is linked at, so the
+        // shape left by rebalance() survives. Returns the bytes of node storage given back.
+        std::size_t compact();
+
+        // Relinks the towers in one pass over level 0 so that every second node of a level
+        // also reaches the level above, as in a perfect skip list. Nodes stay where they are:
+        // a node whose tower is too short passes its turn to the next node that is tall
+        // enough, and its links above its new height are cleared.
+        void rebalance();
+
+        // Average number of links a successful search examines (forward moves plus the
+        // failed comparison that ends each level). 0 for an empty list.
+        double average_search_length() const;
+
         // Test requirements
-        std::shared_ptr<Node<T>> get_first_node_at_0() const;
+        Node<T, KeyCache>* get_first_node_at_0() const;
 
         // Main functionality
-        void insert(const T& value);
+        // Inserts return the element with the value and whether it was inserted
+        std::pair<iterator, bool> insert(const T& value);
+        std::pair<iterator, bool> insert(T&& value);
+
+        // Constructs the value from args and moves it into a node if it is new. The search
+        // needs the value, so it is built before the duplicate check and a duplicate still
+        // pays for it; try_emplace() builds the value only once the key is known to be new.
+        template <typename... Args>
+        std::pair<iterator, bool> emplace(Args&&... args);
+
+        // Looks up key and constructs the value from args, or from key alone, only if no
+        // equivalent element exists. The value must be equivalent to key. Unless Compare
+        // is transparent, the value is constructed first and looked up instead.
+        template <typename K, typename... Args>
+        std::pair<iterator, bool> try_emplace(const K& key, Args&&... args);
+
         bool contains(const T& value) const;
         bool erase(const T& value);
 
+        // With a transparent Compare any key ordered against T is looked up as it is,
+        // e.g. a std::string_view in a list of std::string, without building a T
+        template <typename K>
+        bool contains(const K& key) const requires transparent;
+        template <typename K>
+        bool erase(const K& key) requires transparent;
+
+        // Lookups descend the towers like contains() and return a position at level 0:
+        // find() the equivalent element or end(), lower_bound() the first element not
+        // ordered before the key, upper_bound() the first element ordered after it.
+        // Elements are unique, so equal_range() holds at most one element.
+        iterator find(const T& value);
+        const_iterator find(const T& value) const;
+        iterator lower_bound(const T& value);
+        const_iterator lower_bound(const T& value) const;
+        iterator upper_bound(const T& value);
+        const_iterator upper_bound(const T& value) const;
+        std::pair<iterator, iterator> equal_range(const T& value);
+        std::pair<const_iterator, const_iterator> equal_range(const T& value) const;
+
+        template <typename K>
+        iterator find(const K& key) requires transparent;
+        template <typename K>
+        const_iterator find(const K& key) const requires transparent;
+        template <typename K>
+        iterator lower_bound(const K& key) requires transparent;
+        template <typename K>
+        const_iterator lower_bound(const K& key) const requires transparent;
+        template <typename K>
+        iterator upper_bound(const K& key) requires transparent;
+        template <typename K>
+        const_iterator upper_bound(const K& key) const requires transparent;
+        template <typename K>
+        std::pair<iterator, iterator> equal_range(const K& key) requires transparent;
+        template <typename K>
+        std::pair<const_iterator, const_iterator> equal_range(const K& key) const requires transparent;
+
+        // Inserts an unsorted batch: sorts it (on several threads if it is large), drops
+        // duplicates and merges it into the list in one left-to-right sweep. Each search
+        // starts from the predecessors of the previous value instead of the head.
+        // Returns the number of elements that were not in the list yet.
+        template <std::input_iterator InputIt>
+        std::size_t insert_range(InputIt first, InputIt last);
+
         // operators
-        bool operator==(const SkipList<T>& other) const;
-        bool operator!=(const SkipList<T>& other) const;
+        bool operator==(const SkipList& other) const;
+        bool operator!=(const SkipList& other) const;
         SkipList& operator=(const SkipList& other); // copy assignment operator
-        SkipList& operator=(SkipList&& other) noexcept; // move assignment operator
+        SkipList& operator=(SkipList&& other) noexcept(value_traits::propagate_on_container_move_assignment::value
+                                                       || value_traits::is_always_equal::value); // move assignment operator
         bool operator<(const SkipList& other) const;
         bool operator>(const SkipList& other) const;
         bool operator<=(const SkipList& other) const;
         bool operator>=(const SkipList& other) const;
+
+    private:
+        // Inserts a node constructed from args unless an element equivalent to key exists.
+        // The value is only constructed once the search found no duplicate.
+        template <typename K, typename... Args>
+        std::pair<iterator, bool> insert_unique(const K& key, Args&&... args);
+
+        // Last node at level 0 that goes before key, or the head
+        template <typename K>
+        Node<T, KeyCache>* find_predecessor(const cached_key_type& probe, const K& key) const;
+        template <typename K>
+        bool erase_key(const K& key);
+        // First node not ordered before key and first node ordered after it (nullptr for end)
+        template <typename K>
+        std::pair<Node<T, KeyCache>*, Node<T, KeyCache>*> equal_nodes(const K& key) const;
 };
 
-template <typename T>
-SkipList<T>::SkipList() : head(std::make_unique<Node<T>>(MAX_LEVEL)), current_level(0), num_elements(0) 
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::SkipList() : SkipList(Allocator()) {}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::SkipList(const Allocator& allocator) : SkipList(random_seed(), allocator) {}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::SkipList(std::uint64_t seed, const Allocator& allocator) : SkipList(seed, Compare(), allocator) {}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::SkipList(const Compare& compare, const Allocator& allocator) : SkipList(random_seed(), compare, allocator) {}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::SkipList(std::uint64_t seed, const Compare& compare, const Allocator& allocator) : 
+    alloc(allocator), node_alloc(allocator), comp(compare),
+    head(nullptr), current_level(0), num_elements(0), level_cap(0), next_cap_growth(0), storage(), recycle_limit(0),
+    level_generator(seed)
 {
-    std::random_device rd;
-    rng.seed(rd());
-    dis = std::uniform_real_distribution<>(0.0, 1.0);
+    reset_level_cap();
+    head = create_head();
 }
 
-template <typename T>
-SkipList<T>::SkipList(const SkipList& other) : SkipList() 
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <std::input_iterator InputIt>
+SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::SkipList(InputIt first, InputIt last, const Allocator& allocator) : SkipList(allocator)
 {
-    for (const T& value : other) 
-    {
-        insert(value);
-    }
+    append_sorted(first, last);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <std::input_iterator InputIt>
+SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::SkipList(InputIt first, InputIt last, const Compare& compare, const Allocator& allocator) : 
+    SkipList(compare, allocator)
+{
+    append_sorted(first, last);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::SkipList(const SkipList& other) : 
+    SkipList(other, value_traits::select_on_container_copy_construction(other.alloc)) {}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::SkipList(const SkipList& other, const Allocator& allocator) : SkipList(other.comp, allocator) 
+{
+    recycle_limit = other.recycle_limit;
+    copy_nodes(other);
 }
 
-template <typename T>
-SkipList<T>::SkipList(SkipList&& other) noexcept : 
-    head(std::move(other.head)), 
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::SkipList(SkipList&& other) noexcept : 
+    alloc(other.alloc), node_alloc(other.node_alloc), comp(other.comp),
+    head(other.head), 
     current_level(other.current_level), num_elements(other.num_elements),
-    rng(std::move(other.rng)), 
-    dis(std::move(other.dis))  
+    level_cap(other.level_cap), next_cap_growth(other.next_cap_growth),
+    storage(other.storage), recycle_limit(other.recycle_limit),
+    level_generator(other.level_generator)
 {
-    other.head = std::make_unique<Node<T>>(MAX_LEVEL);
+    other.storage = NodeStorage();
+    other.reset_level_cap();
+
+    other.head = other.create_head();
     other.current_level = 0;
     other.num_elements = 0;
 }
 
-/* Node is now contains shared_ptr so destructor may be default. Keep it if needed later.
-template <typename T>
-SkipList<T>::~SkipList()
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::~SkipList()
 {
-    for (std::size_t i = 0; i < num_elements; ++i)
+    if (release_storage())
     {
-        Node<T>* current = head->next[0];
-
-        while (current != nullptr) 
-        {
-            Node<T>* next_node = current->next[0]; 
-            delete current;                               
-            current = next_node;                         
-        }
+        return;
     }
+    clear();
+    release_spare_nodes();
+    destroy_head();
 }
-*/
 
-template <typename T>
-std::size_t SkipList<T>::get_random_level()
-{   
-    /*
-    std::size_t level = 1;
-    while (dis(rng) < 0.25 && level < MAX_LEVEL)
-    {
-        ++level;
-    }
-    return level;
-    */
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::allocator_type SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::get_allocator() const
+{
+    return alloc;
+}
 
-    // fixed for testing
-    static std::mt19937 fixed_gen(0); 
-    std::uniform_int_distribution<> distrib(0, MAX_LEVEL);
-    std::size_t level = 0;
-    while (distrib(fixed_gen) % 2 == 0 && level < MAX_LEVEL) {
-        level++;
-    }
-    return level;
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::key_compare SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::key_comp() const
+{
+    return comp;
 }
 
-template <typename T>
-std::size_t SkipList<T>::get_current_level() const 
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+std::size_t SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::node_bytes(std::size_t level)
 {
-    return current_level;
+    return NodeChunk<T, KeyCache>::count(level) * sizeof(NodeChunk<T, KeyCache>);
 }
 
-template <typename T>
-std::size_t SkipList<T>::size() const 
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+Node<T, KeyCache>* SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::allocate_node(std::size_t level)
 {
-    return num_elements;
+    NodeChunk<T, KeyCache>* memory = node_traits::allocate(node_alloc, NodeChunk<T, KeyCache>::count(level));
+    storage.allocations++;
+    storage.bytes += node_bytes(level);
+    return ::new (static_cast<void*>(memory)) Node<T, KeyCache>(level);
 }
 
-template <typename T>
-std::shared_ptr<Node<T>> SkipList<T>::get_first_node_at_0() const
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+void SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::deallocate_node(Node<T, KeyCache>* node)
 {
-    return head->next[0];
+    std::size_t level = node->level;
+    node->~Node<T, KeyCache>();
+    node_traits::deallocate(node_alloc, reinterpret_cast<NodeChunk<T, KeyCache>*>(node), NodeChunk<T, KeyCache>::count(level));
+    storage.allocations--;
+    storage.bytes -= node_bytes(level);
 }
 
-template <typename T>
-void SkipList<T>::insert(const T& value)
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+void SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::push_spare_node(Node<T, KeyCache>* node)
 {
-    // Array for predecessors at every level which pointers we have to update
-    std::vector<Node<T>*> update(MAX_LEVEL + 1, nullptr);
+    node->next(0) = storage.spare_nodes[node->level];
+    storage.spare_nodes[node->level] = node;
+    storage.spare_count++;
+    storage.spare_bytes += node_bytes(node->level);
+}
 
-    // current MUST be raw pointer to avoid affect on logic of shared ptrs 
-    Node<T>* current = head.get();
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+Node<T, KeyCache>* SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::pop_spare_node(std::size_t level)
+{
+    Node<T, KeyCache>* node = storage.spare_nodes[level];
+    if (node != nullptr)
+    {
+        storage.spare_nodes[level] = node->next(0);
+        storage.spare_count--;
+        storage.spare_bytes -= node_bytes(level);
+    }
+    return node;
+}
 
-    // Step 1 and 2 
-    for (std::size_t i = current_level + 1; i-- > 0;) // Идем от current_level до 0 включительно
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+void SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::release_spare_nodes()
+{
+    for (std::size_t level = 0; level <= MAX_LEVEL; ++level)
     {
-        while (current->next[i] != nullptr && current->next[i]->getValue() < value)
+        while (storage.spare_nodes[level] != nullptr)
         {
-            current = current->next[i].get();
+            Node<T, KeyCache>* node = storage.spare_nodes[level];
+            storage.spare_nodes[level] = node->next(0);
+
+            if (in_block(node))
+            {
+                node->~Node<T, KeyCache>();
+            }
+            else
+            {
+                deallocate_node(node);
+            }
         }
-        update[i] = current;
     }
+    storage.spare_count = 0;
+    storage.spare_bytes = 0;
 
-    // checking for dublicates 
-    if (current->next[0] != nullptr && current->next[0]->getValue() == value) 
+    if (storage.block != nullptr && storage.block_nodes_in_use == 0)
     {
-        return;
+        release_block();
     }
+}
 
-   // Step 3
-   // Generating random level for new node
-    std::size_t new_node_level = get_random_level();
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+bool SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::in_block(const Node<T, KeyCache>* node) const
+{
+    // std::less gives a total order even for pointers into different allocations
+    std::less<const void*> before;
+    const void* address = node;
+    return storage.block != nullptr && !before(address, storage.block)
+        && before(address, storage.block + storage.block_chunks);
+}
 
-    // Check if new level is higher than max level
-    if (new_node_level > current_level)
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+void SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::release_block()
+{
+    node_traits::deallocate(node_alloc, storage.block, storage.block_chunks);
+    storage.allocations--;
+    storage.bytes -= storage.block_chunks * sizeof(NodeChunk<T, KeyCache>);
+    storage.block = nullptr;
+    storage.block_chunks = 0;
+    storage.block_nodes_in_use = 0;
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+Node<T, KeyCache>* SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::create_head()
+{
+    return allocate_node(level_cap);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+void SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::grow_head(std::size_t level)
+{
+    Node<T, KeyCache>* grown = allocate_node(level);
+    for (std::size_t i = 0; i <= head->level; ++i)
     {
-        for (std::size_t i = current_level + 1; i <= new_node_level; ++i) 
-        {
-            update[i] = head.get(); 
-        }
-        current_level = new_node_level;
+        grown->next(i) = head->next(i);
+        grown->key(i) = head->key(i);
     }
+    deallocate_node(head);
+    head = grown;
+}
 
-    // Step 4
-    // Creating and inserting a node
-    std::shared_ptr<Node<T>> new_node = std::make_shared<Node<T>>(value, new_node_level);
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+void SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::reset_level_cap()
+{
+    level_cap = 1;
+    next_cap_growth = 1.0 / LevelPolicy::probability;
+}
 
-    for (std::size_t i = 0; i <= new_node_level; ++i)
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+void SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::destroy_head()
+{
+    deallocate_node(head);
+    head = nullptr;
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename... Args>
+Node<T, KeyCache>* SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::create_node(std::size_t level, Args&&... args)
+{
+    Node<T, KeyCache>* node = pop_spare_node(level);
+    if (node == nullptr)
     {
-        new_node->next[i] = update[i]->next[i];
-        update[i]->next[i] = new_node; 
+        node = allocate_node(level);
+    }
+    else if (in_block(node))
+    {
+        storage.block_nodes_in_use++;
     }
 
-    num_elements++;
-
-    // DEBUG
-    /*
-    std::cout << "DEBUG: Inserted value: " << value << ". Current list on level 0: ";
-    std::shared_ptr<Node<T>> debug_current = head->next[0];
-    while (debug_current != nullptr) 
+    try
+    {
+        value_traits::construct(alloc, std::addressof(node->getValue()), std::forward<Args>(args)...);
+    }
+    catch (...)
     {
-        std::cout << debug_current->getValue() << " ";
-        debug_current = debug_current->next[0];
+        if (in_block(node))
+        {
+            storage.block_nodes_in_use--;
+        }
+        push_spare_node(node);
+        throw;
     }
-    std::cout << std::endl;
-    std::cout << "DEBUG: current_level after insert: " << current_level << std::endl;
-    */
+    return node;
 }
 
-template <typename T>
-bool SkipList<T>::contains(const T& value) const
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+std::size_t SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::linked_height(const Node<T, KeyCache>** expected, std::size_t top, const Node<T, KeyCache>* node)
 {
-    // std::cout << "DEBUG: contains(" << value << ") called. current_level: " << current_level << std::endl;
+    std::size_t height = 0;
+    while (height < top && expected[height + 1] == node)
+    {
+        ++height;
+    }
+    for (std::size_t i = 0; i <= height; ++i)
+    {
+        expected[i] = node->next(i);
+    }
+    return height;
+}
 
-    Node<T>* current = head.get();
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+void SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::copy_nodes(const SkipList& other)
+{
+    if (other.level_cap > head->level)
+    {
+        grow_head(other.level_cap);
+    }
+    level_cap = other.level_cap;
+    next_cap_growth = other.next_cap_growth;
+    current_level = other.current_level;
+
+    // Last copied node on every level, and the next node of other expected there
+    Node<T, KeyCache>* last[MAX_LEVEL + 1];
+    const Node<T, KeyCache>* expected[MAX_LEVEL + 1];
+    for (std::size_t i = 0; i <= current_level; ++i)
+    {
+        last[i] = head;
+        expected[i] = other.head->next(i);
+    }
 
-    for (std::size_t level = current_level + 1; level-- > 0;)
+    // The list stays valid after every node, so a throwing copy leaves a shorter list to clean up
+    for (const Node<T, KeyCache>* source = other.head->next(0); source != nullptr; source = source->next(0))
     {
-        while (current->next[level] != nullptr && current->next[level]->getValue() < value)
+        const std::size_t height = linked_height(expected, current_level, source);
+
+        Node<T, KeyCache>* node = create_node(height, source->getValue());
+        const cached_key_type key = KeyCache::make(node->getValue());
+        for (std::size_t i = 0; i <= height; ++i)
         {
-            current = current->next[level].get();
+            node->next(i) = nullptr;
+            last[i]->next(i) = node;
+            last[i]->key(i) = key;
+            last[i] = node;
         }
+        num_elements++;
     }
+}
 
-    bool found = (current->next[0] != nullptr && current->next[0]->getValue() == value);
-
-    /*
-    if (found)
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename InputIt>
+void SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::append_sorted(InputIt first, InputIt last)
+{
+    // Last node on every level up to current_level
+    Node<T, KeyCache>* tail[MAX_LEVEL + 1];
+    for (std::size_t i = 0; i <= current_level; ++i)
     {
-        std::cout << "DEBUG: contains: found value" << current->next[0]->getValue() << std::endl;
+        tail[i] = head;
     }
 
-    else 
+    for (; first != last; ++first)
     {
-        std::cout << "DEBUG: contains: Value " << value << " not found." << std::endl;
+        auto&& value = *first;
+        if (tail[0] != head && !comp(tail[0]->getValue(), value))
+        {
+            assert(!comp(value, tail[0]->getValue()) && "SkipList: range is not sorted");
+            continue;
+        }
 
-        if (current != head.get()) 
+        std::size_t level = get_random_level();
+        if (level > current_level)
         {
-            std::cout << "DEBUG: contains: After loop, current value: " << current->getValue() << std::endl;
-        } 
+            raise_current_level(level, tail);
+        }
 
-        else 
+        Node<T, KeyCache>* node = create_node(level, std::forward<decltype(value)>(value));
+        const cached_key_type key = KeyCache::make(node->getValue());
+        // A recycled node still has the links of its spare list
+        for (std::size_t i = 0; i <= level; ++i)
         {
-            std::cout << "DEBUG: contains: After loop, current value: [HEAD_NODE]" << std::endl;
+            node->next(i) = nullptr;
+            tail[i]->next(i) = node;
+            tail[i]->key(i) = key;
+            tail[i] = node;
         }
-    }
-    */
 
-    return found;
+        num_elements++;
+        update_level_cap();
+    }
 }
 
-template <typename T>
-bool SkipList<T>::erase(const T& value)
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+void SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::raise_current_level(std::size_t level, Node<T, KeyCache>** update)
 {
-    // Logic is similar for insert() at the beginning
-    std::vector<Node<T>*> update(MAX_LEVEL + 1);
-
-    Node<T>* current = head.get();
-
-    for (std::size_t i = current_level; i>= 1; --i)
+    if (level > head->level)
     {
-        while (current->next[i] != nullptr && current->next[i]->getValue() < value)
+        Node<T, KeyCache>* old_head = head;
+        grow_head(level_cap);
+        for (std::size_t i = 0; i <= current_level; ++i)
         {
-            current = current->next[i].get();
+            if (update[i] == old_head)
+            {
+                update[i] = head;
+            }
         }
-        update[i] = current;
     }
 
-    while(current->next[0] != nullptr && current->next[0]->getValue() < value)
+    for (std::size_t i = current_level + 1; i <= level; ++i)
     {
-        current = current->next[0].get();
+        update[i] = head;
     }
-    update[0] = current;
+    current_level = level;
+}
 
-    // Here we go other way
-    std::shared_ptr<Node<T>> node_to_delete = current->next[0];
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+void SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::update_level_cap()
+{
+    if (level_cap < MAX_LEVEL && static_cast<double>(num_elements) >= next_cap_growth)
+    {
+        level_cap++;
+        next_cap_growth /= LevelPolicy::probability;
+    }
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+void SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::destroy_node(Node<T, KeyCache>* node)
+{
+    value_traits::destroy(alloc, std::addressof(node->getValue()));
 
-    if (node_to_delete != nullptr && node_to_delete->getValue() == value) 
+    if (in_block(node))
     {
-        // Element is found. Now delete it and update pointers. 
-        for (std::size_t i = 0; i <= node_to_delete->level; ++i)
-        {
-            if (update[i]->next[i] == node_to_delete) 
-            {
-                update[i]->next[i] = node_to_delete->next[i];
-            }
-        }
+        storage.block_nodes_in_use--;
+        push_spare_node(node);
+    }
+    else if (storage.spare_bytes + node_bytes(node->level) <= recycle_limit)
+    {
+        push_spare_node(node);
+    }
+    else
+    {
+        deallocate_node(node);
+    }
+}
 
-        num_elements--;
+// Teardown shortcut for node pools (see NodePool::holds_only). If the pool holds
+// nothing but this list, values are destroyed and all slabs are dropped at once
+// instead of returning every node to a free list. A monotonic memory resource
+// ignores deallocation altogether, so there only the values need destroying.
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+bool SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::release_storage()
+{
+    if constexpr (requires(node_allocator_type& a) { a.get_pool().holds_only(std::size_t{}); })
+    {
+        auto& pool = node_alloc.get_pool();
 
-        // Update current level 
-        while (current_level > 0 && head->next[current_level] == nullptr) 
+        if (pool.holds_only(storage.allocations))
         {
-            current_level--;
+            destroy_values();
+            pool.release();
+            head = nullptr;
+            return true;
+        }
+    }
+    else if constexpr (std::is_same_v<Allocator, std::pmr::polymorphic_allocator<T>>)
+    {
+        if (dynamic_cast<std::pmr::monotonic_buffer_resource*>(alloc.resource()) != nullptr)
+        {
+            destroy_values();
+            head = nullptr;
+            return true;
         }
-        return true;
     }
-
     return false;
 }
 
-template <typename T>
-bool SkipList<T>::empty() const
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+void SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::destroy_values() noexcept
 {
-    return num_elements == 0;
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        for (Node<T, KeyCache>* current = head->next(0); current != nullptr; current = current->next(0))
+        {
+            value_traits::destroy(alloc, std::addressof(current->getValue()));
+        }
+    }
 }
 
-// operators
-template <typename T>
-SkipList<T>& SkipList<T>::operator=(SkipList&& other) noexcept 
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+void SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::clear() noexcept
 {
-    if (this != &other) 
-    {
-        head.reset(); 
+    Node<T, KeyCache>* current = head->next(0);
 
-        head = std::move(other.head);
-        current_level = other.current_level;
-        num_elements = other.num_elements;
-        rng = std::move(other.rng);
-        dis = std::move(other.dis);
+    while (current != nullptr) 
+    {
+        Node<T, KeyCache>* next_node = current->next(0); 
+        destroy_node(current);
+        current = next_node;                         
+    }
 
-        other.head = std::make_unique<Node<T>>(MAX_LEVEL);
-        other.current_level = 0;
-        other.num_elements = 0;
+    for (std::size_t i = 0; i <= current_level; ++i)
+    {
+        head->next(i) = nullptr;
     }
-    return *this;
+    current_level = 0;
+    num_elements = 0;
+    // Later inserts draw towers for the new size, not for the old peak
+    reset_level_cap();
 }
 
-template <typename T>
-SkipList<T>& SkipList<T>::operator=(const SkipList& other) 
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <std::input_iterator InputIt>
+void SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::assign(InputIt first, InputIt last)
 {
-    if (this != &other) 
-    { 
-        SkipList temp(other); 
-        std::swap(head, temp.head);
-        std::swap(current_level, temp.current_level);
-        std::swap(num_elements, temp.num_elements);
-    }
-    return *this;
+    clear();
+    append_sorted(first, last);
 }
 
-template <typename T>
-bool SkipList<T>::operator==(const SkipList& other) const 
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+std::size_t SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::capacity() const
 {
-    if (num_elements != other.num_elements) 
+    return num_elements + storage.spare_count;
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+void SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::reserve(std::size_t n)
+{
+    if (n <= capacity())
     {
-        return false;
+        return;
     }
 
-    auto it1 = cbegin();
-    auto it2 = other.cbegin();
+    // The level cap the list will have reached at n elements
+    std::size_t cap = level_cap;
+    for (double growth = next_cap_growth; cap < MAX_LEVEL && static_cast<double>(n) >= growth; growth /= LevelPolicy::probability)
+    {
+        cap++;
+    }
 
-    for (; it1 != cend() && it2 != other.cend(); ++it1, ++it2) 
+    // Give the head those levels now, so that inserts up to n never reallocate it
+    if (cap > head->level)
     {
-        if (!(*it1 == *it2)) 
-        { 
-            return false;
+        grow_head(cap);
+    }
+
+    std::size_t missing = n - capacity();
+    std::size_t counts[MAX_LEVEL + 1];
+    std::size_t total = 0;
+
+    for (std::size_t level = 0; level <= MAX_LEVEL; ++level)
+    {
+        counts[level] = static_cast<std::size_t>(static_cast<double>(missing) * level_probability(level, cap));
+        total += counts[level];
+    }
+    // Rounding leftovers go to level 0, the most likely level
+    counts[0] += missing - total;
+
+    for (std::size_t level = 0; level <= MAX_LEVEL; ++level)
+    {
+        for (std::size_t i = 0; i < counts[level]; ++i)
+        {
+            push_spare_node(allocate_node(level));
         }
     }
-    return true;
 }
 
-template <typename T>
-bool SkipList<T>::operator<(const SkipList& other) const 
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+void SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::shrink_to_fit() noexcept
 {
-    auto it1 = cbegin();
-    auto end1 = cend();
-    auto it2 = other.cbegin();
-    auto end2 = other.cend();
+    release_spare_nodes();
+}
 
-    for (; it1 != end1 && it2 != end2; ++it1, ++it2) 
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+std::size_t SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::memory_usage() const
+{
+    return storage.bytes;
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+std::vector<typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::HeightStats> SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::height_stats() const
+{
+    std::vector<HeightStats> stats(MAX_LEVEL + 1);
+    for (std::size_t level = 0; level <= MAX_LEVEL; ++level)
     {
-        if (*it1 < *it2) 
-        { 
-            return true;
-        }
-        if (*it2 < *it1) 
-        { 
-            return false;
+        stats[level].node_bytes = node_bytes(level);
+        for (const Node<T, KeyCache>* spare = storage.spare_nodes[level]; spare != nullptr; spare = spare->next(0))
+        {
+            stats[level].spare_nodes++;
         }
     }
 
-    return (it1 == end1 && it2 != end2);
+    const Node<T, KeyCache>* expected[MAX_LEVEL + 1];
+    for (std::size_t i = 0; i <= current_level; ++i)
+    {
+        expected[i] = head->next(i);
+    }
+    for (const Node<T, KeyCache>* current = head->next(0); current != nullptr; current = current->next(0))
+    {
+        stats[linked_height(expected, current_level, current)].nodes++;
+    }
+    return stats;
 }
 
-template <typename T>
-bool SkipList<T>::operator>(const SkipList& other) const 
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+void SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::set_recycle_limit(std::size_t limit)
 {
-    return other < *this; 
+    recycle_limit = limit;
 }
 
-template <typename T>
-bool SkipList<T>::operator<=(const SkipList& other) const 
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+std::size_t SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::get_recycle_limit() const
 {
-    return !(*this > other); 
+    return recycle_limit;
 }
 
-template <typename T>
-bool SkipList<T>::operator>=(const SkipList& other) const 
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+std::size_t SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::compact()
 {
-    return !(*this < other); 
+    using Chunk = NodeChunk<T, KeyCache>;
+
+    const std::size_t bytes_before = storage.bytes;
+
+    // Size the new nodes by the height they are linked at, which rebalance() may have lowered
+    const Node<T, KeyCache>* expected[MAX_LEVEL + 1];
+    for (std::size_t i = 0; i <= current_level; ++i)
+    {
+        expected[i] = head->next(i);
+    }
+    std::size_t chunks = 0;
+    for (Node<T, KeyCache>* current = head->next(0); current != nullptr; current = current->next(0))
+    {
+        chunks += Chunk::count(linked_height(expected, current_level, current));
+    }
+    for (std::size_t i = 0; i <= current_level; ++i)
+    {
+        expected[i] = head->next(i);
+    }
+
+    Chunk* block = chunks != 0 ? node_traits::allocate(node_alloc, chunks) : nullptr;
+    Chunk* cursor = block;
+
+    // Values are moved if that cannot throw, otherwise copied so that the list stays intact on failure
+    try
+    {
+        for (Node<T, KeyCache>* current = head->next(0); current != nullptr; current = current->next(0))
+        {
+            const std::size_t height = linked_height(expected, current_level, current);
+            Node<T, KeyCache>* node = ::new (static_cast<void*>(cursor)) Node<T, KeyCache>(height);
+            try
+            {
+                value_traits::construct(alloc, std::addressof(node->getValue()), std::move_if_noexcept(current->getValue()));
+            }
+            catch (...)
+            {
+                node->~Node<T, KeyCache>();
+                throw;
+            }
+            cursor += Chunk::count(height);
+        }
+    }
+    catch (...)
+    {
+        for (Chunk* done = block; done != cursor; )
+        {
+            Node<T, KeyCache>* node = reinterpret_cast<Node<T, KeyCache>*>(done);
+            done += Chunk::count(node->level);
+            value_traits::destroy(alloc, std::addressof(node->getValue()));
+            node->~Node<T, KeyCache>();
+        }
+        node_traits::deallocate(node_alloc, block, chunks);
+        throw;
+    }
+
+    // Link the new nodes in block order, which is key order
+    Node<T, KeyCache>* old_nodes = head->next(0);
+    Node<T, KeyCache>* last[MAX_LEVEL + 1];
+    for (std::size_t i = 0; i <= MAX_LEVEL; ++i)
+    {
+        last[i] = head;
+    }
+
+    std::size_t top = 0;
+    for (Chunk* position = block; position != cursor; )
+    {
+        Node<T, KeyCache>* node = reinterpret_cast<Node<T, KeyCache>*>(position);
+        const cached_key_type key = KeyCache::make(node->getValue());
+        for (std::size_t i = 0; i <= node->level; ++i)
+        {
+            last[i]->next(i) = node;
+            last[i]->key(i) = key;
+            last[i] = node;
+        }
+        top = std::max<std::size_t>(top, node->level);
+        position += Chunk::count(node->level);
+    }
+    for (std::size_t i = 0; i <= std::max(top, current_level); ++i)
+    {
+        last[i]->next(i) = nullptr;
+    }
+    current_level = top;
+
+    // Drop the old nodes, the spares and the previous block
+    while (old_nodes != nullptr)
+    {
+        Node<T, KeyCache>* next_node = old_nodes->next(0);
+        value_traits::destroy(alloc, std::addressof(old_nodes->getValue()));
+        if (in_block(old_nodes))
+        {
+            old_nodes->~Node<T, KeyCache>();
+        }
+        else
+        {
+            deallocate_node(old_nodes);
+        }
+        old_nodes = next_node;
+    }
+    storage.block_nodes_in_use = 0;
+    release_spare_nodes();
+
+    if (block != nullptr)
+    {
+        storage.block = block;
+        storage.block_chunks = chunks;
+        storage.block_nodes_in_use = num_elements;
+        storage.allocations++;
+        storage.bytes += chunks * sizeof(Chunk);
+    }
+    return bytes_before - storage.bytes;
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+std::size_t SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::get_random_level()
+{   
+    return level_generator(level_cap);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+std::uint64_t SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::random_seed()
+{
+    return random_level_seed();
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+double SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::level_probability(std::size_t level, std::size_t cap)
+{
+    return LevelPolicy::generator_type::probability(level, cap);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename K>
+typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::cached_key_type SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::make_probe(const K& key)
+{
+    if constexpr (caches_key<K>)
+    {
+        return KeyCache::make(key);
+    }
+    else
+    {
+        return cached_key_type();
+    }
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename K>
+bool SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::goes_right(const Node<T, KeyCache>* current, std::size_t i, const cached_key_type& probe, const K& key) const
+{
+    const Node<T, KeyCache>* next = current->next(i);
+    if (next == nullptr)
+    {
+        return false;
+    }
+
+    if constexpr (caches_key<K>)
+    {
+        int order = KeyCache::compare(current->key(i), probe);
+        if (order != 0)
+        {
+            return order < 0;
+        }
+        if constexpr (KeyCache::exact)
+        {
+            return false;
+        }
+    }
+    return comp(next->getValue(), key);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename K>
+bool SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::next_matches(const Node<T, KeyCache>* current, const cached_key_type& probe, const K& key) const
+{
+    const Node<T, KeyCache>* next = current->next(0);
+    if (next == nullptr)
+    {
+        return false;
+    }
+
+    if constexpr (caches_key<K>)
+    {
+        int order = KeyCache::compare(current->key(0), probe);
+        if (order != 0 || KeyCache::exact)
+        {
+            return order == 0;
+        }
+    }
+    // next is not less than key, so it matches unless key is less
+    return !comp(key, next->getValue());
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+std::size_t SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::get_current_level() const 
+{
+    return current_level;
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+std::size_t SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::size() const 
+{
+    return num_elements;
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+void SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::rebalance()
+{
+    Node<T, KeyCache>* last[MAX_LEVEL + 1];
+    // Nodes of level i - 1 passed since the last node of level i
+    std::size_t passed[MAX_LEVEL + 2] = {};
+    for (std::size_t i = 0; i <= MAX_LEVEL; ++i)
+    {
+        last[i] = head;
+    }
+
+    std::size_t top = 0;
+    for (Node<T, KeyCache>* current = head->next(0); current != nullptr; current = current->next(0))
+    {
+        std::size_t height = 0;
+        while (++passed[height + 1] >= 2 && height < current->level && height < head->level)
+        {
+            ++height;
+            passed[height] = 0;
+        }
+
+        const cached_key_type key = KeyCache::make(current->getValue());
+        for (std::size_t i = 0; i <= height; ++i)
+        {
+            last[i]->next(i) = current;
+            last[i]->key(i) = key;
+            last[i] = current;
+        }
+        for (std::size_t i = height + 1; i <= current->level; ++i)
+        {
+            current->next(i) = nullptr;
+        }
+        if (height > top)
+        {
+            top = height;
+        }
+    }
+
+    for (std::size_t i = 0; i <= std::max(top, current_level); ++i)
+    {
+        last[i]->next(i) = nullptr;
+    }
+    current_level = top;
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+double SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::average_search_length() const
+{
+    if (num_elements == 0)
+    {
+        return 0;
+    }
+
+    // A search for x moves right on level i over the nodes between the last node
+    // before x on level i + 1 and the last node before x on level i: moves[i].
+    // Walking level 0 keeps these counts for the next node, one level list at a time.
+    const Node<T, KeyCache>* expected[MAX_LEVEL + 1];
+    std::size_t moves[MAX_LEVEL + 1] = {};
+    for (std::size_t i = 0; i <= current_level; ++i)
+    {
+        expected[i] = head->next(i);
+    }
+
+    std::size_t path_moves = 0;
+    double total = 0;
+    for (const Node<T, KeyCache>* current = head->next(0); current != nullptr; current = current->next(0))
+    {
+        total += static_cast<double>(path_moves);
+
+        const std::size_t height = linked_height(expected, current_level, current);
+        for (std::size_t i = 0; i < height; ++i)
+        {
+            path_moves -= moves[i];
+            moves[i] = 0;
+        }
+        moves[height]++;
+        path_moves++;
+    }
+
+    return total / static_cast<double>(num_elements) + static_cast<double>(current_level + 1);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+Node<T, KeyCache>* SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::get_first_node_at_0() const
+{
+    return head->next(0);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+std::pair<typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::iterator, bool> SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::insert(const T& value)
+{
+    return insert_unique(value, value);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+std::pair<typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::iterator, bool> SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::insert(T&& value)
+{
+    // value is only moved from once it is known to be new
+    return insert_unique(value, std::move(value));
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename... Args>
+std::pair<typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::iterator, bool> SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::emplace(Args&&... args)
+{
+    if constexpr (sizeof...(Args) == 1 && (std::is_same_v<std::remove_cvref_t<Args>, T> && ...))
+    {
+        return insert_unique(args..., std::forward<Args>(args)...);
+    }
+    else
+    {
+        // The search needs the value, so it is built on the stack and moved into the node
+        T value(std::forward<Args>(args)...);
+        return insert_unique(value, std::move(value));
+    }
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename K, typename... Args>
+std::pair<typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::iterator, bool> SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::try_emplace(const K& key, Args&&... args)
+{
+    if constexpr (!transparent && !std::is_same_v<K, T>)
+    {
+        // Compare would convert key to T at every step, so the value is built first
+        if constexpr (sizeof...(Args) == 0)
+        {
+            T value(key);
+            return insert_unique(value, std::move(value));
+        }
+        else
+        {
+            T value(std::forward<Args>(args)...);
+            return insert_unique(value, std::move(value));
+        }
+    }
+    else if constexpr (sizeof...(Args) == 0)
+    {
+        return insert_unique(key, key);
+    }
+    else
+    {
+        std::pair<iterator, bool> result = insert_unique(key, std::forward<Args>(args)...);
+        assert((!result.second || (!comp(key, *result.first) && !comp(*result.first, key))) && "SkipList: value is not equivalent to its key");
+        return result;
+    }
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename K, typename... Args>
+std::pair<typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::iterator, bool> SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::insert_unique(const K& key, Args&&... args)
+{
+    // Array for predecessors at every level which pointers we have to update
+    Node<T, KeyCache>* update[MAX_LEVEL + 1] = {};
+
+    const cached_key_type probe = make_probe(key);
+    Node<T, KeyCache>* current = head;
+
+    // Step 1 and 2 
+    for (std::size_t i = current_level + 1; i-- > 0;) // Идем от current_level до 0 включительно
+    {
+        while (goes_right(current, i, probe, key))
+        {
+            current = current->next(i);
+        }
+        update[i] = current;
+    }
+
+    // checking for dublicates 
+    if (next_matches(current, probe, key)) 
+    {
+        return {iterator(current->next(0)), false};
+    }
+
+   // Step 3
+   // Generating random level for new node
+    std::size_t new_node_level = get_random_level();
+
+    // Check if new level is higher than max level
+    if (new_node_level > current_level)
+    {
+        raise_current_level(new_node_level, update);
+    }
+
+    // Step 4
+    // Creating and inserting a node
+    Node<T, KeyCache>* new_node = create_node(new_node_level, std::forward<Args>(args)...);
+    const cached_key_type new_key = KeyCache::make(new_node->getValue());
+
+    for (std::size_t i = 0; i <= new_node_level; ++i)
+    {
+        new_node->next(i) = update[i]->next(i);
+        new_node->key(i) = update[i]->key(i);
+        update[i]->next(i) = new_node; 
+        update[i]->key(i) = new_key;
+    }
+
+    num_elements++;
+    update_level_cap();
+    return {iterator(new_node), true};
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+void SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::sort_batch(std::vector<T, Allocator>& batch) const
+{
+    const std::size_t threads = std::min<std::size_t>(std::thread::hardware_concurrency(), batch.size() / PARALLEL_SORT_CHUNK);
+    if (threads < 2)
+    {
+        std::sort(batch.begin(), batch.end(), comp);
+        return;
+    }
+
+    // Sort equal slices side by side, then merge neighbours of growing width
+    std::vector<std::size_t> bounds(threads + 1);
+    for (std::size_t k = 0; k <= threads; ++k)
+    {
+        bounds[k] = batch.size() * k / threads;
+    }
+
+    auto data = batch.begin();
+    std::vector<std::exception_ptr> errors(threads);
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    try
+    {
+        for (std::size_t k = 1; k < threads; ++k)
+        {
+            workers.emplace_back([&, k]
+            {
+                try
+                {
+                    std::sort(data + bounds[k], data + bounds[k + 1], comp);
+                }
+                catch (...)
+                {
+                    errors[k] = std::current_exception();
+                }
+            });
+        }
+    }
+    catch (...)
+    {
+        // No more threads to be had: the started ones must be joined before
+        // they are destroyed, then the whole batch is sorted on this one
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+        std::sort(batch.begin(), batch.end(), comp);
+        return;
+    }
+    try
+    {
+        std::sort(data, data + bounds[1], comp);
+    }
+    catch (...)
+    {
+        errors[0] = std::current_exception();
+    }
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+    for (const std::exception_ptr& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    for (std::size_t width = 1; width < threads; width *= 2)
+    {
+        for (std::size_t k = 0; k + width < threads; k += 2 * width)
+        {
+            std::inplace_merge(data + bounds[k], data + bounds[k + width], data + bounds[std::min(k + 2 * width, threads)], comp);
+        }
+    }
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <std::input_iterator InputIt>
+std::size_t SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::insert_range(InputIt first, InputIt last)
+{
+    // Copies are made with the list's allocator, as the nodes' values are
+    std::vector<T, Allocator> batch(first, last, alloc);
+    sort_batch(batch);
+    batch.erase(std::unique(batch.begin(), batch.end(), [this](const T& a, const T& b) { return !comp(a, b); }), batch.end());
+
+    // Predecessors of the previously merged value on every level
+    Node<T, KeyCache>* update[MAX_LEVEL + 1] = {};
+    for (std::size_t i = 0; i <= current_level; ++i)
+    {
+        update[i] = head;
+    }
+
+    std::size_t inserted = 0;
+    for (T& value : batch)
+    {
+        const cached_key_type probe = KeyCache::make(value);
+
+        // Climb while the previous predecessor is left behind on the level above, then
+        // descend as insert() does. Levels above the climb keep their predecessors.
+        std::size_t top = 0;
+        while (top < current_level && goes_right(update[top + 1], top + 1, probe, value))
+        {
+            ++top;
+        }
+        Node<T, KeyCache>* current = update[top];
+        for (std::size_t i = top + 1; i-- > 0;)
+        {
+            while (goes_right(current, i, probe, value))
+            {
+                current = current->next(i);
+            }
+            update[i] = current;
+        }
+
+        if (next_matches(current, probe, value))
+        {
+            continue;
+        }
+
+        std::size_t new_node_level = get_random_level();
+        if (new_node_level > current_level)
+        {
+            raise_current_level(new_node_level, update);
+        }
+
+        Node<T, KeyCache>* new_node = create_node(new_node_level, std::move(value));
+        for (std::size_t i = 0; i <= new_node_level; ++i)
+        {
+            new_node->next(i) = update[i]->next(i);
+            new_node->key(i) = update[i]->key(i);
+            update[i]->next(i) = new_node;
+            update[i]->key(i) = probe;
+            update[i] = new_node;
+        }
+
+        num_elements++;
+        update_level_cap();
+        inserted++;
+    }
+    return inserted;
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+bool SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::contains(const T& value) const
+{
+    const cached_key_type probe = KeyCache::make(value);
+    Node<T, KeyCache>* current = find_predecessor(probe, value);
+    return next_matches(current, probe, value);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename K>
+bool SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::contains(const K& key) const requires transparent
+{
+    const cached_key_type probe = make_probe(key);
+    return next_matches(find_predecessor(probe, key), probe, key);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename K>
+Node<T, KeyCache>* SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::find_predecessor(const cached_key_type& probe, const K& key) const
+{
+    Node<T, KeyCache>* current = head;
+    for (std::size_t level = current_level + 1; level-- > 0;)
+    {
+        while (goes_right(current, level, probe, key))
+        {
+            current = current->next(level);
+        }
+    }
+    return current;
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+bool SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::erase(const T& value)
+{
+    return erase_key(value);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename K>
+bool SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::erase(const K& key) requires transparent
+{
+    return erase_key(key);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename K>
+bool SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::erase_key(const K& value)
+{
+    // Logic is similar for insert() at the beginning
+    Node<T, KeyCache>* update[MAX_LEVEL + 1] = {};
+
+    const cached_key_type probe = make_probe(value);
+    Node<T, KeyCache>* current = head;
+
+    for (std::size_t i = current_level; i>= 1; --i)
+    {
+        while (goes_right(current, i, probe, value))
+        {
+            current = current->next(i);
+        }
+        update[i] = current;
+    }
+
+    while(goes_right(current, 0, probe, value))
+    {
+        current = current->next(0);
+    }
+    update[0] = current;
+
+    // Here we go other way
+    Node<T, KeyCache>* node_to_delete = current->next(0);
+
+    if (next_matches(current, probe, value)) 
+    {
+        // Element is found. Now delete it and update pointers. 
+        // After rebalance() a tower may be taller than the levels it is linked on
+        for (std::size_t i = 0; i <= node_to_delete->level && i <= current_level; ++i)
+        {
+            if (update[i]->next(i) == node_to_delete) 
+            {
+                update[i]->next(i) = node_to_delete->next(i);
+                update[i]->key(i) = node_to_delete->key(i);
+            }
+        }
+
+        destroy_node(node_to_delete);
+        num_elements--;
+
+        // Update current level 
+        while (current_level > 0 && head->next(current_level) == nullptr) 
+        {
+            current_level--;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename K>
+std::pair<Node<T, KeyCache>*, Node<T, KeyCache>*> SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::equal_nodes(const K& key) const
+{
+    const cached_key_type probe = make_probe(key);
+    Node<T, KeyCache>* current = find_predecessor(probe, key);
+    Node<T, KeyCache>* first = current->next(0);
+    return {first, next_matches(current, probe, key) ? first->next(0) : first};
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::iterator SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::find(const T& value)
+{
+    std::pair<Node<T, KeyCache>*, Node<T, KeyCache>*> nodes = equal_nodes(value);
+    return iterator(nodes.first != nodes.second ? nodes.first : nullptr);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::const_iterator SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::find(const T& value) const
+{
+    std::pair<Node<T, KeyCache>*, Node<T, KeyCache>*> nodes = equal_nodes(value);
+    return const_iterator(nodes.first != nodes.second ? nodes.first : nullptr);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::iterator SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::lower_bound(const T& value)
+{
+    return iterator(equal_nodes(value).first);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::const_iterator SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::lower_bound(const T& value) const
+{
+    return const_iterator(equal_nodes(value).first);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::iterator SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::upper_bound(const T& value)
+{
+    return iterator(equal_nodes(value).second);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::const_iterator SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::upper_bound(const T& value) const
+{
+    return const_iterator(equal_nodes(value).second);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+std::pair<typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::iterator, typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::iterator> SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::equal_range(const T& value)
+{
+    std::pair<Node<T, KeyCache>*, Node<T, KeyCache>*> nodes = equal_nodes(value);
+    return {iterator(nodes.first), iterator(nodes.second)};
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+std::pair<typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::const_iterator, typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::const_iterator> SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::equal_range(const T& value) const
+{
+    std::pair<Node<T, KeyCache>*, Node<T, KeyCache>*> nodes = equal_nodes(value);
+    return {const_iterator(nodes.first), const_iterator(nodes.second)};
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename K>
+typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::iterator SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::find(const K& key) requires transparent
+{
+    std::pair<Node<T, KeyCache>*, Node<T, KeyCache>*> nodes = equal_nodes(key);
+    return iterator(nodes.first != nodes.second ? nodes.first : nullptr);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename K>
+typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::const_iterator SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::find(const K& key) const requires transparent
+{
+    std::pair<Node<T, KeyCache>*, Node<T, KeyCache>*> nodes = equal_nodes(key);
+    return const_iterator(nodes.first != nodes.second ? nodes.first : nullptr);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename K>
+typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::iterator SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::lower_bound(const K& key) requires transparent
+{
+    return iterator(equal_nodes(key).first);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename K>
+typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::const_iterator SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::lower_bound(const K& key) const requires transparent
+{
+    return const_iterator(equal_nodes(key).first);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename K>
+typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::iterator SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::upper_bound(const K& key) requires transparent
+{
+    return iterator(equal_nodes(key).second);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename K>
+typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::const_iterator SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::upper_bound(const K& key) const requires transparent
+{
+    return const_iterator(equal_nodes(key).second);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename K>
+std::pair<typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::iterator, typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::iterator> SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::equal_range(const K& key) requires transparent
+{
+    std::pair<Node<T, KeyCache>*, Node<T, KeyCache>*> nodes = equal_nodes(key);
+    return {iterator(nodes.first), iterator(nodes.second)};
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+template <typename K>
+std::pair<typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::const_iterator, typename SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::const_iterator> SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::equal_range(const K& key) const requires transparent
+{
+    std::pair<Node<T, KeyCache>*, Node<T, KeyCache>*> nodes = equal_nodes(key);
+    return {const_iterator(nodes.first), const_iterator(nodes.second)};
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+bool SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::empty() const
+{
+    return num_elements == 0;
+}
+
+// operators
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>& SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::operator=(SkipList&& other) noexcept(value_traits::propagate_on_container_move_assignment::value
+                                                                                    || value_traits::is_always_equal::value)
+{
+    if (this != &other) 
+    {
+        clear();
+        comp = other.comp;
+
+        if (value_traits::propagate_on_container_move_assignment::value || node_alloc == other.node_alloc)
+        {
+            // Our empty head goes to other together with the allocator that owns it
+            if constexpr (value_traits::propagate_on_container_move_assignment::value)
+            {
+                std::swap(alloc, other.alloc);
+                std::swap(node_alloc, other.node_alloc);
+            }
+            std::swap(head, other.head);
+            std::swap(storage, other.storage);
+            std::swap(level_cap, other.level_cap);
+            std::swap(next_cap_growth, other.next_cap_growth);
+            current_level = other.current_level;
+            num_elements = other.num_elements;
+        }
+        else
+        {
+            // Nodes of other belong to a different allocator, so values are moved over
+            for (T& value : other)
+            {
+                insert(std::move(value));
+            }
+            other.clear();
+        }
+
+        other.current_level = 0;
+        other.num_elements = 0;
+    }
+    return *this;
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>& SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::operator=(const SkipList& other) 
+{
+    if (this != &other) 
+    { 
+        SkipList temp(other, value_traits::propagate_on_container_copy_assignment::value ? other.alloc : alloc); 
+        std::swap(alloc, temp.alloc);
+        std::swap(node_alloc, temp.node_alloc);
+        std::swap(comp, temp.comp);
+        std::swap(head, temp.head);
+        std::swap(current_level, temp.current_level);
+        std::swap(num_elements, temp.num_elements);
+        std::swap(level_cap, temp.level_cap);
+        std::swap(next_cap_growth, temp.next_cap_growth);
+        std::swap(storage, temp.storage);
+    }
+    return *this;
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+bool SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::operator==(const SkipList& other) const 
+{
+    if (num_elements != other.num_elements) 
+    {
+        return false;
+    }
+
+    auto it1 = cbegin();
+    auto it2 = other.cbegin();
+
+    for (; it1 != cend() && it2 != other.cend(); ++it1, ++it2) 
+    {
+        if (!(*it1 == *it2)) 
+        { 
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+bool SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::operator<(const SkipList& other) const 
+{
+    auto it1 = cbegin();
+    auto end1 = cend();
+    auto it2 = other.cbegin();
+    auto end2 = other.cend();
+
+    for (; it1 != end1 && it2 != end2; ++it1, ++it2) 
+    {
+        if (*it1 < *it2) 
+        { 
+            return true;
+        }
+        if (*it2 < *it1) 
+        { 
+            return false;
+        }
+    }
+
+    return (it1 == end1 && it2 != end2);
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+bool SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::operator>(const SkipList& other) const 
+{
+    return other < *this; 
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+bool SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::operator<=(const SkipList& other) const 
+{
+    return !(*this > other); 
+}
+
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+bool SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::operator>=(const SkipList& other) const 
+{
+    return !(*this < other); 
+}
+
+namespace pmr
+{
+    // SkipList whose nodes come from a std::pmr::memory_resource. Lists on a
+    // monotonic_buffer_resource skip per-node deallocation at teardown and only
+    // destroy their values; the memory goes away with the arena.
+    template <typename T, typename Compare = std::less<>, typename KeyCache = NoKeyCache, typename LevelPolicy = ::LevelPolicy<>>
+    using SkipList = ::SkipList<T, Compare, std::pmr::polymorphic_allocator<T>, KeyCache, LevelPolicy>;
 }
 
-#endif
\ No newline at end of file
+#endif
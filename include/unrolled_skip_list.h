@@ -0,0 +1,780 @@
+#ifndef UNROLLED_SKIP_LIST_H
+#define UNROLLED_SKIP_LIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "level_generator.h"
+
+// Unrolled skip list: level 0 is a chain of blocks, each holding up to
+// BlockCapacity sorted keys, and the towers index blocks by their first key.
+// A search descends the towers to one block and finishes with a binary search
+// inside it; a scan walks keys stored next to each other.
+//
+// A full block is split in half on insert. A block that falls below a quarter
+// of its capacity on erase is merged with its successor if the two together
+// fill at most three quarters of a block, so the merged block still has room
+// for inserts. Otherwise it borrows keys until both hold about the same number.
+template <typename T, std::size_t BlockCapacity = 32, typename LevelPolicy = ::LevelPolicy<>>
+class UnrolledSkipList
+{
+    static_assert(BlockCapacity >= 4 && BlockCapacity <= 0xFFFF, "BlockCapacity must be between 4 and 65535");
+
+    private:
+        static const std::size_t MAX_LEVEL = LevelPolicy::max_level;
+        static const std::size_t MIN_FILL = BlockCapacity / 4;
+
+        // Block keeps the keys and its forward pointers in a single allocation (see Node)
+        struct Block
+        {
+            std::uint16_t count;
+            std::uint8_t level;
+            alignas(T) unsigned char storage[BlockCapacity * sizeof(T)];
+
+            explicit Block(std::size_t _level) : count(0), level(static_cast<std::uint8_t>(_level))
+            {
+                for (std::size_t i = 0; i <= _level; ++i)
+                {
+                    ::new (static_cast<void*>(tower() + i)) Block*(nullptr);
+                }
+            }
+
+            static constexpr std::size_t tower_offset()
+            {
+                return (sizeof(Block) + alignof(Block*) - 1) / alignof(Block*) * alignof(Block*);
+            }
+
+            static constexpr std::size_t allocation_size(std::size_t level)
+            {
+                return tower_offset() + (level + 1) * sizeof(Block*);
+            }
+
+            Block** tower()
+            {
+                return reinterpret_cast<Block**>(reinterpret_cast<unsigned char*>(this) + tower_offset());
+            }
+
+            Block* const* tower() const
+            {
+                return reinterpret_cast<Block* const*>(reinterpret_cast<const unsigned char*>(this) + tower_offset());
+            }
+
+            Block*& next(std::size_t i) { return tower()[i]; }
+            Block* next(std::size_t i) const { return tower()[i]; }
+
+            T* keys() { return std::launder(reinterpret_cast<T*>(storage)); }
+            const T* keys() const { return std::launder(reinterpret_cast<const T*>(storage)); }
+
+            const T& first() const { return keys()[0]; }
+
+            // Index of the first key not less than value
+            std::size_t lower_bound(const T& value) const
+            {
+                return static_cast<std::size_t>(std::lower_bound(keys(), keys() + count, value) - keys());
+            }
+
+            void insert_at(std::size_t pos, const T& value);
+            void erase_at(std::size_t pos);
+
+            // Moves keys [from, count) to the end of other
+            void move_tail_to(Block* other, std::size_t from);
+            // Moves the first n keys to the end of other
+            void move_front_to(Block* other, std::size_t n);
+        };
+
+        Block* head;
+
+        std::size_t current_level;
+        std::size_t num_elements;
+        std::size_t num_blocks;
+
+        // Towers index blocks, so levels are drawn up to level_cap, which grows with
+        // num_blocks the way SkipList's grows with its elements
+        std::size_t level_cap;
+        double next_cap_growth;
+
+        // Every list draws its levels from its own generator
+        typename LevelPolicy::generator_type level_generator;
+        std::size_t get_random_level();
+        void reset_level_cap();
+        void update_level_cap();
+
+        Block* create_block(std::size_t level);
+        void destroy_block(Block* block);
+
+        // Last block at every level whose first key is less than value (head if none)
+        Block* find_predecessors(const T& value, Block** update) const;
+
+        // Links or unlinks the block that follows `left` on level 0. Its predecessor
+        // is left on the levels left reaches and update[i] above them.
+        void link_after(Block* block, Block* const* update, Block* left);
+        void unlink(Block* block, Block* const* update, Block* left);
+        void fix_underflow(Block* block, Block* const* update);
+
+    public:
+        // ==============================
+
+        class const_iterator;
+
+        class iterator
+        {
+            private:
+                Block* block;
+                std::size_t index;
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = T*;
+                using reference = T&;
+
+                friend class const_iterator;
+
+                explicit iterator(Block* block_ptr = nullptr, std::size_t position = 0) : block(block_ptr), index(position) {}
+
+                reference operator*() const
+                {
+                    if (!block)
+                    {
+                        throw std::out_of_range("Dereferencing null iterator.");
+                    }
+                    return block->keys()[index];
+                }
+
+                pointer operator->() const
+                {
+                    return &(**this);
+                }
+
+                iterator& operator++()
+                {
+                    if (block && ++index == block->count)
+                    {
+                        block = block->next(0);
+                        index = 0;
+                    }
+                    return *this;
+                }
+
+                iterator operator++(int)
+                {
+                    iterator temp = *this;
+                    ++(*this);
+                    return temp;
+                }
+
+                bool operator==(const iterator& other) const { return block == other.block && index == other.index; }
+                bool operator!=(const iterator& other) const { return !(*this == other); }
+
+                bool operator==(const const_iterator& other) const { return block == other.block && index == other.index; }
+                bool operator!=(const const_iterator& other) const { return !(*this == other); }
+        };
+
+        class const_iterator
+        {
+            friend class iterator;
+            private:
+                const Block* block;
+                std::size_t index;
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const T*;
+                using reference = const T&;
+
+                explicit const_iterator(const Block* block_ptr = nullptr, std::size_t position = 0) : block(block_ptr), index(position) {}
+
+                // transition constructor
+                const_iterator(const iterator& other) : block(other.block), index(other.index) {}
+
+                reference operator*() const
+                {
+                    if (!block)
+                    {
+                        throw std::out_of_range("Dereferencing null iterator.");
+                    }
+                    return block->keys()[index];
+                }
+
+                pointer operator->() const
+                {
+                    return &(**this);
+                }
+
+                const_iterator& operator++()
+                {
+                    if (block && ++index == block->count)
+                    {
+                        block = block->next(0);
+                        index = 0;
+                    }
+                    return *this;
+                }
+
+                const_iterator operator++(int)
+                {
+                    const_iterator temp = *this;
+                    ++(*this);
+                    return temp;
+                }
+
+                bool operator==(const const_iterator& other) const { return block == other.block && index == other.index; }
+                bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+                bool operator==(const iterator& other) const { return block == other.block && index == other.index; }
+                bool operator!=(const iterator& other) const { return !(*this == other); }
+        };
+
+        iterator begin() { return iterator(head->next(0)); }
+        const_iterator begin() const { return const_iterator(head->next(0)); }
+        iterator end() { return iterator(nullptr); }
+        const_iterator end() const { return const_iterator(nullptr); }
+        const_iterator cbegin() const { return const_iterator(head->next(0)); }
+        const_iterator cend() const { return const_iterator(nullptr); }
+
+        // ======================
+
+        UnrolledSkipList();
+        // Seeds the level generator, so that the same inserts always build the same towers
+        explicit UnrolledSkipList(std::uint64_t seed);
+        ~UnrolledSkipList();
+
+        UnrolledSkipList(const UnrolledSkipList& other);
+        UnrolledSkipList(UnrolledSkipList&& other) noexcept;
+
+        std::size_t get_current_level() const;
+        std::size_t size() const;
+        std::size_t block_count() const;
+        bool empty() const;
+
+        void clear() noexcept;
+
+        void insert(const T& value);
+        bool contains(const T& value) const;
+        bool erase(const T& value);
+
+        bool operator==(const UnrolledSkipList& other) const;
+        bool operator!=(const UnrolledSkipList& other) const;
+        UnrolledSkipList& operator=(const UnrolledSkipList& other);
+        UnrolledSkipList& operator=(UnrolledSkipList&& other) noexcept;
+        bool operator<(const UnrolledSkipList& other) const;
+        bool operator>(const UnrolledSkipList& other) const;
+        bool operator<=(const UnrolledSkipList& other) const;
+        bool operator>=(const UnrolledSkipList& other) const;
+};
+
+// Block key operations
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+void UnrolledSkipList<T, BlockCapacity, LevelPolicy>::Block::insert_at(std::size_t pos, const T& value)
+{
+    T* data = keys();
+    if (pos == count)
+    {
+        ::new (static_cast<void*>(data + count)) T(value);
+    }
+    else
+    {
+        T copy(value);
+        ::new (static_cast<void*>(data + count)) T(std::move(data[count - 1]));
+        std::move_backward(data + pos, data + count - 1, data + count);
+        data[pos] = std::move(copy);
+    }
+    ++count;
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+void UnrolledSkipList<T, BlockCapacity, LevelPolicy>::Block::erase_at(std::size_t pos)
+{
+    T* data = keys();
+    std::move(data + pos + 1, data + count, data + pos);
+    data[count - 1].~T();
+    --count;
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+void UnrolledSkipList<T, BlockCapacity, LevelPolicy>::Block::move_tail_to(Block* other, std::size_t from)
+{
+    T* data = keys();
+    T* target = other->keys();
+    for (std::size_t i = from; i < count; ++i)
+    {
+        ::new (static_cast<void*>(target + other->count)) T(std::move(data[i]));
+        ++other->count;
+        data[i].~T();
+    }
+    count = static_cast<std::uint16_t>(from);
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+void UnrolledSkipList<T, BlockCapacity, LevelPolicy>::Block::move_front_to(Block* other, std::size_t n)
+{
+    T* data = keys();
+    T* target = other->keys();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        ::new (static_cast<void*>(target + other->count)) T(std::move(data[i]));
+        ++other->count;
+    }
+    std::move(data + n, data + count, data);
+    for (std::size_t i = count - n; i < count; ++i)
+    {
+        data[i].~T();
+    }
+    count = static_cast<std::uint16_t>(count - n);
+}
+
+// List
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+UnrolledSkipList<T, BlockCapacity, LevelPolicy>::UnrolledSkipList() : UnrolledSkipList(random_level_seed()) {}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+UnrolledSkipList<T, BlockCapacity, LevelPolicy>::UnrolledSkipList(std::uint64_t seed) :
+    head(nullptr), current_level(0), num_elements(0), num_blocks(0), level_cap(0), next_cap_growth(0),
+    level_generator(seed)
+{
+    reset_level_cap();
+    head = create_block(MAX_LEVEL);
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+UnrolledSkipList<T, BlockCapacity, LevelPolicy>::UnrolledSkipList(const UnrolledSkipList& other) : UnrolledSkipList()
+{
+    for (const T& value : other)
+    {
+        insert(value);
+    }
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+UnrolledSkipList<T, BlockCapacity, LevelPolicy>::UnrolledSkipList(UnrolledSkipList&& other) noexcept :
+    head(other.head), current_level(other.current_level),
+    num_elements(other.num_elements), num_blocks(other.num_blocks),
+    level_cap(other.level_cap), next_cap_growth(other.next_cap_growth),
+    level_generator(other.level_generator)
+{
+    other.head = other.create_block(MAX_LEVEL);
+    other.current_level = 0;
+    other.num_elements = 0;
+    other.num_blocks = 0;
+    other.reset_level_cap();
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+UnrolledSkipList<T, BlockCapacity, LevelPolicy>::~UnrolledSkipList()
+{
+    clear();
+    destroy_block(head);
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+std::size_t UnrolledSkipList<T, BlockCapacity, LevelPolicy>::get_random_level()
+{
+    return level_generator(level_cap);
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+void UnrolledSkipList<T, BlockCapacity, LevelPolicy>::reset_level_cap()
+{
+    level_cap = 1;
+    next_cap_growth = 1.0 / LevelPolicy::probability;
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+void UnrolledSkipList<T, BlockCapacity, LevelPolicy>::update_level_cap()
+{
+    if (level_cap < MAX_LEVEL && static_cast<double>(num_blocks) >= next_cap_growth)
+    {
+        level_cap++;
+        next_cap_growth /= LevelPolicy::probability;
+    }
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+typename UnrolledSkipList<T, BlockCapacity, LevelPolicy>::Block* UnrolledSkipList<T, BlockCapacity, LevelPolicy>::create_block(std::size_t level)
+{
+    void* memory;
+    // Over-aligned keys need the aligned operator new, or storage would be misaligned
+    if constexpr (alignof(Block) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    {
+        memory = ::operator new(Block::allocation_size(level), std::align_val_t(alignof(Block)));
+    }
+    else
+    {
+        memory = ::operator new(Block::allocation_size(level));
+    }
+    return ::new (memory) Block(level);
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+void UnrolledSkipList<T, BlockCapacity, LevelPolicy>::destroy_block(Block* block)
+{
+    T* data = block->keys();
+    for (std::size_t i = 0; i < block->count; ++i)
+    {
+        data[i].~T();
+    }
+    block->~Block();
+    if constexpr (alignof(Block) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    {
+        ::operator delete(block, std::align_val_t(alignof(Block)));
+    }
+    else
+    {
+        ::operator delete(block);
+    }
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+typename UnrolledSkipList<T, BlockCapacity, LevelPolicy>::Block* UnrolledSkipList<T, BlockCapacity, LevelPolicy>::find_predecessors(const T& value, Block** update) const
+{
+    Block* current = head;
+
+    for (std::size_t i = current_level + 1; i-- > 0;)
+    {
+        while (current->next(i) != nullptr && current->next(i)->first() < value)
+        {
+            current = current->next(i);
+        }
+        if (update)
+        {
+            update[i] = current;
+        }
+    }
+
+    if (update)
+    {
+        for (std::size_t i = current_level + 1; i <= MAX_LEVEL; ++i)
+        {
+            update[i] = head;
+        }
+    }
+    return current;
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+void UnrolledSkipList<T, BlockCapacity, LevelPolicy>::link_after(Block* block, Block* const* update, Block* left)
+{
+    if (block->level > current_level)
+    {
+        current_level = block->level;
+    }
+    for (std::size_t i = 0; i <= block->level; ++i)
+    {
+        Block* previous = (left->level >= i) ? left : update[i];
+        block->next(i) = previous->next(i);
+        previous->next(i) = block;
+    }
+    num_blocks++;
+    update_level_cap();
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+void UnrolledSkipList<T, BlockCapacity, LevelPolicy>::unlink(Block* block, Block* const* update, Block* left)
+{
+    for (std::size_t i = 0; i <= block->level; ++i)
+    {
+        Block* previous = (left->level >= i) ? left : update[i];
+        previous->next(i) = block->next(i);
+    }
+    destroy_block(block);
+    num_blocks--;
+
+    while (current_level > 0 && head->next(current_level) == nullptr)
+    {
+        current_level--;
+    }
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+void UnrolledSkipList<T, BlockCapacity, LevelPolicy>::fix_underflow(Block* block, Block* const* update)
+{
+    Block* successor = block->next(0);
+
+    if (successor == nullptr)
+    {
+        if (block->count == 0)
+        {
+            // Only a block that lost its first key can become empty, and then
+            // update[] are its predecessors
+            unlink(block, update, update[0]);
+        }
+        return;
+    }
+
+    // Merge only if the result leaves a quarter of the block free, so that the
+    // next few inserts do not split it again
+    if (block->count + successor->count <= BlockCapacity * 3 / 4)
+    {
+        successor->move_tail_to(block, 0);
+        unlink(successor, update, block);
+    }
+    else
+    {
+        successor->move_front_to(block, (successor->count - block->count) / 2);
+    }
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+std::size_t UnrolledSkipList<T, BlockCapacity, LevelPolicy>::get_current_level() const
+{
+    return current_level;
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+std::size_t UnrolledSkipList<T, BlockCapacity, LevelPolicy>::size() const
+{
+    return num_elements;
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+std::size_t UnrolledSkipList<T, BlockCapacity, LevelPolicy>::block_count() const
+{
+    return num_blocks;
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+bool UnrolledSkipList<T, BlockCapacity, LevelPolicy>::empty() const
+{
+    return num_elements == 0;
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+void UnrolledSkipList<T, BlockCapacity, LevelPolicy>::clear() noexcept
+{
+    Block* current = head->next(0);
+    while (current != nullptr)
+    {
+        Block* next_block = current->next(0);
+        destroy_block(current);
+        current = next_block;
+    }
+
+    for (std::size_t i = 0; i <= current_level; ++i)
+    {
+        head->next(i) = nullptr;
+    }
+    current_level = 0;
+    num_elements = 0;
+    num_blocks = 0;
+    reset_level_cap();
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+void UnrolledSkipList<T, BlockCapacity, LevelPolicy>::insert(const T& value)
+{
+    Block* update[MAX_LEVEL + 1];
+    Block* left = find_predecessors(value, update);
+    Block* right = left->next(0);
+
+    // checking for dublicates at the start of the next block
+    if (right != nullptr && right->first() == value)
+    {
+        return;
+    }
+
+    // Keys smaller than every first key go to the front of the first block
+    Block* target = (left == head) ? right : left;
+
+    if (target == nullptr)
+    {
+        target = create_block(get_random_level());
+        link_after(target, update, head);
+    }
+
+    std::size_t pos = target->lower_bound(value);
+    if (pos < target->count && target->keys()[pos] == value)
+    {
+        return;
+    }
+
+    if (target->count == BlockCapacity)
+    {
+        // Split: the upper half moves into a new block right after target
+        Block* upper = create_block(get_random_level());
+        target->move_tail_to(upper, BlockCapacity / 2);
+        link_after(upper, update, target);
+
+        if (pos > BlockCapacity / 2)
+        {
+            target = upper;
+            pos -= BlockCapacity / 2;
+        }
+    }
+
+    target->insert_at(pos, value);
+    num_elements++;
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+bool UnrolledSkipList<T, BlockCapacity, LevelPolicy>::contains(const T& value) const
+{
+    Block* left = find_predecessors(value, nullptr);
+    Block* right = left->next(0);
+
+    if (right != nullptr && right->first() == value)
+    {
+        return true;
+    }
+    if (left == head)
+    {
+        return false;
+    }
+
+    std::size_t pos = left->lower_bound(value);
+    return pos < left->count && left->keys()[pos] == value;
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+bool UnrolledSkipList<T, BlockCapacity, LevelPolicy>::erase(const T& value)
+{
+    Block* update[MAX_LEVEL + 1];
+    Block* left = find_predecessors(value, update);
+    Block* right = left->next(0);
+
+    if (right != nullptr && right->first() == value)
+    {
+        // value is the first key of right, so update[] are the predecessors of right
+        right->erase_at(0);
+        num_elements--;
+        if (right->count < MIN_FILL)
+        {
+            fix_underflow(right, update);
+        }
+        return true;
+    }
+
+    if (left == head)
+    {
+        return false;
+    }
+
+    std::size_t pos = left->lower_bound(value);
+    if (pos == left->count || !(left->keys()[pos] == value))
+    {
+        return false;
+    }
+
+    // pos > 0 here, so left keeps at least one key and its position
+    left->erase_at(pos);
+    num_elements--;
+    if (left->count < MIN_FILL)
+    {
+        fix_underflow(left, update);
+    }
+    return true;
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+UnrolledSkipList<T, BlockCapacity, LevelPolicy>& UnrolledSkipList<T, BlockCapacity, LevelPolicy>::operator=(const UnrolledSkipList& other)
+{
+    if (this != &other)
+    {
+        UnrolledSkipList temp(other);
+        std::swap(head, temp.head);
+        std::swap(current_level, temp.current_level);
+        std::swap(num_elements, temp.num_elements);
+        std::swap(num_blocks, temp.num_blocks);
+        std::swap(level_cap, temp.level_cap);
+        std::swap(next_cap_growth, temp.next_cap_growth);
+    }
+    return *this;
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+UnrolledSkipList<T, BlockCapacity, LevelPolicy>& UnrolledSkipList<T, BlockCapacity, LevelPolicy>::operator=(UnrolledSkipList&& other) noexcept
+{
+    if (this != &other)
+    {
+        clear();
+        std::swap(head, other.head);
+        current_level = other.current_level;
+        num_elements = other.num_elements;
+        num_blocks = other.num_blocks;
+        level_cap = other.level_cap;
+        next_cap_growth = other.next_cap_growth;
+
+        other.current_level = 0;
+        other.num_elements = 0;
+        other.num_blocks = 0;
+        other.reset_level_cap();
+    }
+    return *this;
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+bool UnrolledSkipList<T, BlockCapacity, LevelPolicy>::operator==(const UnrolledSkipList& other) const
+{
+    if (num_elements != other.num_elements)
+    {
+        return false;
+    }
+
+    auto it2 = other.cbegin();
+    for (auto it1 = cbegin(); it1 != cend(); ++it1, ++it2)
+    {
+        if (!(*it1 == *it2))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+bool UnrolledSkipList<T, BlockCapacity, LevelPolicy>::operator!=(const UnrolledSkipList& other) const
+{
+    return !(*this == other);
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+bool UnrolledSkipList<T, BlockCapacity, LevelPolicy>::operator<(const UnrolledSkipList& other) const
+{
+    auto it1 = cbegin();
+    auto end1 = cend();
+    auto it2 = other.cbegin();
+    auto end2 = other.cend();
+
+    for (; it1 != end1 && it2 != end2; ++it1, ++it2)
+    {
+        if (*it1 < *it2)
+        {
+            return true;
+        }
+        if (*it2 < *it1)
+        {
+            return false;
+        }
+    }
+
+    return (it1 == end1 && it2 != end2);
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+bool UnrolledSkipList<T, BlockCapacity, LevelPolicy>::operator>(const UnrolledSkipList& other) const
+{
+    return other < *this;
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+bool UnrolledSkipList<T, BlockCapacity, LevelPolicy>::operator<=(const UnrolledSkipList& other) const
+{
+    return !(*this > other);
+}
+
+template <typename T, std::size_t BlockCapacity, typename LevelPolicy>
+bool UnrolledSkipList<T, BlockCapacity, LevelPolicy>::operator>=(const UnrolledSkipList& other) const
+{
+    return !(*this < other);
+}
+
+#endif
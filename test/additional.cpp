@@ -1,7 +1,7 @@
 #include "../include/skip_list.h"
 
-template <typename T>
-const std::size_t SkipList<T>::MAX_LEVEL;
+template <typename T, typename Compare, typename Allocator, typename KeyCache, typename LevelPolicy>
+const std::size_t SkipList<T, Compare, Allocator, KeyCache, LevelPolicy>::MAX_LEVEL;
 
 template const std::size_t SkipList<int>::MAX_LEVEL;
 template const std::size_t SkipList<double>::MAX_LEVEL;
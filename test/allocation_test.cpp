@@ -0,0 +1,181 @@
+#include "gtest/gtest.h"
+#include "../include/skip_list.h"
+#include "counting_allocator.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+
+// Regression limits for heap traffic of the hot paths: insert() allocates its node and
+// nothing else, contains() and erase() never allocate. Every operator new is counted, so
+// a temporary container anywhere in these paths shows up here. The replacement is global,
+// so this file is linked into its own test binary (test_allocation) and not test_skip_list.
+
+namespace
+{
+    std::atomic<std::size_t> global_allocations{0};
+}
+
+void* operator new(std::size_t size)
+{
+    global_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size != 0 ? size : 1))
+    {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+using test_support::CountingAllocator;
+
+namespace
+{
+    using TrackedList = SkipList<int, std::less<>, CountingAllocator<int>>;
+
+    // Heap allocations made by f, through any path
+    template <typename F>
+    std::size_t allocations_during(F&& f)
+    {
+        std::size_t before = global_allocations.load(std::memory_order_relaxed);
+        f();
+        return global_allocations.load(std::memory_order_relaxed) - before;
+    }
+}
+
+TEST(AllocationTest, InsertAllocatesOnlyItsNode)
+{
+    TrackedList list(1, CountingAllocator<int>());
+    const std::size_t nodes_before = list.get_allocator().counter->allocations;
+
+    std::size_t heap = allocations_during([&]
+    {
+        for (int i = 0; i < 100000; ++i)
+        {
+            list.insert((i * 7919) % 100000);
+        }
+    });
+
+    // Besides one node per element only the head is reallocated, once per level the cap grows
+    const std::size_t nodes = list.get_allocator().counter->allocations - nodes_before;
+    EXPECT_EQ(heap, nodes);
+    EXPECT_GE(nodes, 100000);
+    EXPECT_LE(nodes, 100000 + 32);
+}
+
+TEST(AllocationTest, InsertOfDuplicateAllocatesNothing)
+{
+    TrackedList list;
+    for (int i = 0; i < 1000; ++i)
+    {
+        list.insert(i);
+    }
+
+    EXPECT_EQ(0, allocations_during([&]
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            list.insert(i);
+        }
+    }));
+}
+
+TEST(AllocationTest, ContainsAllocatesNothing)
+{
+    SkipList<std::string, std::less<>, std::allocator<std::string>, StringPrefixKeyCache> list;
+    for (int i = 0; i < 1000; ++i)
+    {
+        list.insert("key" + std::to_string(i));
+    }
+    const std::string hit = "key500";
+    const std::string miss = "key5000";
+
+    EXPECT_EQ(0, allocations_during([&]
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            EXPECT_TRUE(list.contains(hit));
+            EXPECT_FALSE(list.contains(miss));
+        }
+    }));
+}
+
+TEST(AllocationTest, EraseAllocatesNothing)
+{
+    TrackedList list;
+    for (int i = 0; i < 10000; ++i)
+    {
+        list.insert(i);
+    }
+    const std::size_t released_before = list.get_allocator().counter->deallocations;
+
+    EXPECT_EQ(0, allocations_during([&]
+    {
+        for (int i = 0; i < 10000; i += 2)
+        {
+            list.erase(i);
+        }
+        for (int i = 0; i < 10000; i += 2)
+        {
+            list.erase(i);
+        }
+    }));
+    EXPECT_EQ(5000, list.get_allocator().counter->deallocations - released_before);
+}
+
+TEST(AllocationTest, ReservedAndRecycledNodesAllocateNothing)
+{
+    // After reserve() the head already has the levels n elements will use
+    TrackedList list(2, CountingAllocator<int>());
+    list.reserve(10000);
+    list.set_recycle_limit(std::size_t(1) << 20);
+
+    std::size_t heap = allocations_during([&]
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            list.insert(i);
+        }
+        for (int i = 0; i < 1000; ++i)
+        {
+            list.erase(i);
+        }
+    });
+    EXPECT_EQ(0, heap);
+}
+
+TEST(AllocationTest, HeterogeneousLookupAllocatesNothing)
+{
+    // Keys longer than the small string buffer, so a temporary std::string would allocate
+    SkipList<std::string, std::less<>, std::allocator<std::string>, StringPrefixKeyCache> list;
+    for (int i = 0; i < 1000; ++i)
+    {
+        list.insert("a rather long key number " + std::to_string(i));
+    }
+    const std::string_view hit = "a rather long key number 500";
+    const char* miss = "a rather long key number 5000";
+
+    EXPECT_EQ(0, allocations_during([&]
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            EXPECT_TRUE(list.contains(hit));
+            EXPECT_FALSE(list.contains(miss));
+        }
+        EXPECT_TRUE(list.erase(hit));
+        EXPECT_FALSE(list.contains(hit));
+    }));
+}
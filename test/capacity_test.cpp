@@ -0,0 +1,303 @@
+#include "gtest/gtest.h"
+#include "../include/skip_list.h"
+#include "counting_allocator.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+using test_support::AllocationCounter;
+using test_support::CountingAllocator;
+
+TEST(CapacityTest, ReserveRaisesCapacity)
+{
+    SkipList<int> list;
+    EXPECT_EQ(list.capacity(), 0);
+
+    list.reserve(1000);
+    EXPECT_GE(list.capacity(), 1000);
+    EXPECT_EQ(list.size(), 0);
+
+    list.reserve(10);
+    EXPECT_GE(list.capacity(), 1000);
+}
+
+TEST(CapacityTest, InsertsAfterReserveRarelyAllocate)
+{
+    SkipList<int, std::less<>, CountingAllocator<int>> list;
+    std::shared_ptr<AllocationCounter> counter = list.get_allocator().counter;
+
+    list.reserve(10000);
+    std::size_t reserved = counter->allocations;
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        list.insert(i);
+    }
+
+    // Only levels drawn beyond what the distribution predicted need fresh nodes
+    EXPECT_LT(counter->allocations - reserved, 500);
+    EXPECT_EQ(list.size(), 10000);
+    EXPECT_TRUE(list.contains(9999));
+}
+
+TEST(CapacityTest, ShrinkToFitReleasesSpareNodes)
+{
+    SkipList<int, std::less<>, CountingAllocator<int>> list;
+    std::shared_ptr<AllocationCounter> counter = list.get_allocator().counter;
+
+    list.reserve(2000);
+    for (int i = 0; i < 100; ++i)
+    {
+        list.insert(i);
+    }
+    list.shrink_to_fit();
+
+    EXPECT_EQ(list.capacity(), list.size());
+    EXPECT_EQ(counter->live(), list.size() + 1); // nodes and the head
+}
+
+TEST(CapacityTest, ClearKeepsSpareNodes)
+{
+    SkipList<std::string> list;
+    list.reserve(100);
+    list.insert("Apple");
+    list.insert("Banana");
+    std::size_t capacity = list.capacity();
+
+    list.clear();
+
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.capacity(), capacity - 2);
+    list.insert("Cherry");
+    EXPECT_EQ(*list.begin(), "Cherry");
+}
+
+TEST(CapacityTest, MoveTakesSpareNodes)
+{
+    std::shared_ptr<AllocationCounter> counter;
+    {
+        SkipList<int, std::less<>, CountingAllocator<int>> list;
+        counter = list.get_allocator().counter;
+        list.reserve(500);
+
+        SkipList<int, std::less<>, CountingAllocator<int>> moved(std::move(list));
+        EXPECT_GE(moved.capacity(), 500);
+        EXPECT_EQ(list.capacity(), 0);
+
+        // The allocators differ and do not propagate, so moved keeps its own spare nodes
+        SkipList<int, std::less<>, CountingAllocator<int>> other;
+        other.insert(1);
+        moved = std::move(other);
+        EXPECT_EQ(moved.size(), 1);
+        EXPECT_GE(moved.capacity(), 500);
+    }
+    EXPECT_EQ(counter->live(), 0);
+}
+
+TEST(CompactTest, KeepsContentsInKeyOrder)
+{
+    SkipList<std::string> list;
+    for (int i = 0; i < 200; ++i)
+    {
+        list.insert(std::to_string((i * 37) % 200));
+    }
+    SkipList<std::string> expected(list);
+
+    list.compact();
+
+    EXPECT_TRUE(list == expected);
+    EXPECT_TRUE(list.contains("150"));
+    EXPECT_FALSE(list.contains("200"));
+}
+
+TEST(CompactTest, NodesFollowKeyOrderInMemory)
+{
+    SkipList<int> list;
+    for (int i = 0; i < 1000; ++i)
+    {
+        list.insert((i * 7919) % 1000);
+    }
+
+    list.compact();
+
+    const Node<int>* previous = list.get_first_node_at_0();
+    for (const Node<int>* current = previous->next(0); current != nullptr; current = current->next(0))
+    {
+        EXPECT_EQ(reinterpret_cast<const char*>(previous) + Node<int>::allocation_size(previous->level),
+                  reinterpret_cast<const char*>(current));
+        previous = current;
+    }
+}
+
+TEST(CompactTest, ReportsReclaimedBytes)
+{
+    SkipList<int> list;
+    list.reserve(1000);
+    for (int i = 0; i < 10; ++i)
+    {
+        list.insert(i);
+    }
+    std::size_t before = list.memory_usage();
+
+    std::size_t reclaimed = list.compact();
+
+    EXPECT_GT(reclaimed, 0);
+    EXPECT_EQ(list.memory_usage(), before - reclaimed);
+    EXPECT_EQ(list.capacity(), list.size());
+    EXPECT_EQ(list.compact(), 0);
+}
+
+TEST(CompactTest, ErasedBlockNodesAreReused)
+{
+    std::shared_ptr<AllocationCounter> counter;
+    {
+        SkipList<int, std::less<>, CountingAllocator<int>> list;
+        counter = list.get_allocator().counter;
+        for (int i = 0; i < 500; ++i)
+        {
+            list.insert(i);
+        }
+        list.compact();
+        EXPECT_EQ(counter->live(), 2); // head and block
+
+        for (int i = 0; i < 500; i += 2)
+        {
+            EXPECT_TRUE(list.erase(i));
+        }
+        EXPECT_EQ(list.capacity(), 500);
+        EXPECT_TRUE(list.contains(499));
+        EXPECT_FALSE(list.contains(498));
+
+        list.insert(1000);
+        EXPECT_EQ(list.size(), 251);
+
+        list.shrink_to_fit();
+        EXPECT_EQ(list.capacity(), list.size());
+
+        list.clear();
+        list.shrink_to_fit();
+        EXPECT_EQ(counter->live(), 1); // the block went back once no element used it
+    }
+    EXPECT_EQ(counter->live(), 0);
+}
+
+TEST(CompactTest, WorksWithKeyCache)
+{
+    SkipList<int, std::less<>, std::allocator<int>, CopyKeyCache<int>> list;
+    for (int i = 0; i < 300; ++i)
+    {
+        list.insert((i * 101) % 300);
+    }
+
+    list.compact();
+
+    for (int i = 0; i < 300; ++i)
+    {
+        EXPECT_TRUE(list.contains(i));
+    }
+    EXPECT_TRUE(list.erase(150));
+    EXPECT_FALSE(list.contains(150));
+}
+
+TEST(RecycleTest, DisabledByDefault)
+{
+    SkipList<int> list;
+    for (int i = 0; i < 100; ++i)
+    {
+        list.insert(i);
+    }
+    for (int i = 0; i < 100; i += 2)
+    {
+        list.erase(i);
+    }
+
+    EXPECT_EQ(list.get_recycle_limit(), 0);
+    EXPECT_EQ(list.capacity(), list.size());
+}
+
+TEST(RecycleTest, SlidingWindowStopsAllocating)
+{
+    // Seeded: how often a spare list runs dry depends on the drawn levels
+    SkipList<int, std::less<>, CountingAllocator<int>> list(1, CountingAllocator<int>());
+    std::shared_ptr<AllocationCounter> counter = list.get_allocator().counter;
+    list.set_recycle_limit(1 << 16);
+
+    const int window = 1000;
+    for (int i = 0; i < window; ++i)
+    {
+        list.insert(i);
+    }
+    for (int i = window; i < 2 * window; ++i)
+    {
+        list.erase(i - window);
+        list.insert(i);
+    }
+
+    std::size_t warm = counter->allocations;
+    for (int i = 2 * window; i < 12 * window; ++i)
+    {
+        list.erase(i - window);
+        list.insert(i);
+    }
+
+    // Only a level whose spare list happens to be empty needs a fresh node: about one
+    // insert in a hundred with the random walk of spare counts, not every insert
+    EXPECT_LT(counter->allocations - warm, 200);
+    EXPECT_EQ(list.size(), window);
+    EXPECT_TRUE(list.contains(12 * window - 1));
+    EXPECT_FALSE(list.contains(11 * window - 1));
+}
+
+TEST(RecycleTest, CachedMemoryStaysWithinLimit)
+{
+    const std::size_t limit = 4096;
+    SkipList<int> list;
+    list.set_recycle_limit(limit);
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        list.insert(i);
+    }
+    for (int i = 0; i < 2000; ++i)
+    {
+        list.erase(i);
+    }
+
+    EXPECT_GT(list.capacity(), 0);
+    std::size_t cached = list.memory_usage();
+
+    list.shrink_to_fit();
+    EXPECT_EQ(list.capacity(), 0);
+    EXPECT_LT(list.memory_usage(), cached);
+    EXPECT_LE(cached - list.memory_usage(), limit);
+}
+
+TEST(HeightStatsTest, CountsNodesPerHeight)
+{
+    SkipList<int> list;
+    list.reserve(300);
+    for (int i = 0; i < 200; ++i)
+    {
+        list.insert(i);
+    }
+
+    std::vector<SkipList<int>::HeightStats> stats = list.height_stats();
+    ASSERT_FALSE(stats.empty());
+
+    std::size_t nodes = 0;
+    std::size_t spare_nodes = 0;
+    for (std::size_t level = 0; level < stats.size(); ++level)
+    {
+        nodes += stats[level].nodes;
+        spare_nodes += stats[level].spare_nodes;
+        EXPECT_EQ(stats[level].node_bytes, Node<int>::allocation_size(level));
+        if (level > 0)
+        {
+            EXPECT_GT(stats[level].node_bytes, stats[level - 1].node_bytes);
+        }
+    }
+    EXPECT_EQ(nodes, list.size());
+    EXPECT_EQ(spare_nodes, list.capacity() - list.size());
+    EXPECT_GT(stats[0].nodes, stats[3].nodes);
+}
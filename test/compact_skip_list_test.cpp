@@ -0,0 +1,309 @@
+#include "gtest/gtest.h"
+#include "../include/compact_skip_list.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Counts live instances; copies throw while throw_on_copy is set
+    struct Counted
+    {
+        static inline int live = 0;
+        static inline bool throw_on_copy = false;
+
+        int key;
+
+        Counted(int _key) : key(_key) { live++; }
+        Counted(const Counted& other) : key(other.key)
+        {
+            if (throw_on_copy)
+            {
+                throw std::runtime_error("copy failed");
+            }
+            live++;
+        }
+        ~Counted() { live--; }
+
+        bool operator<(const Counted& other) const { return key < other.key; }
+        bool operator==(const Counted& other) const { return key == other.key; }
+    };
+}
+
+class CompactSkipListTest : public ::testing::Test 
+{
+    protected:
+        CompactSkipList<int> int_list;
+
+        bool check_level_0(const std::vector<int>& expected_elements) 
+        {
+            std::vector<int> actual_elements(int_list.begin(), int_list.end());
+            return expected_elements == actual_elements;
+        }
+};
+
+TEST_F(CompactSkipListTest, Initialization) 
+{
+    EXPECT_EQ(0, int_list.get_current_level());
+    EXPECT_EQ(0, int_list.size());
+    EXPECT_TRUE(int_list.begin() == int_list.end());
+}
+
+TEST_F(CompactSkipListTest, Insert_MultipleElements_Randomly)
+{
+    int_list.insert(13);
+    int_list.insert(5);
+    int_list.insert(1);
+    int_list.insert(22);
+    int_list.insert(110);
+    int_list.insert(79);
+    int_list.insert(5);
+
+    EXPECT_TRUE(int_list.contains(13));
+    EXPECT_TRUE(int_list.contains(110));
+    EXPECT_FALSE(int_list.contains(14));
+
+    EXPECT_EQ(6, int_list.size());
+    EXPECT_TRUE(check_level_0({1, 5, 13, 22, 79, 110}));
+}
+
+TEST_F(CompactSkipListTest, Erase_ExistingAndMissing)
+{
+    int_list.insert(10);
+    int_list.insert(20);
+    int_list.insert(30);
+
+    EXPECT_TRUE(int_list.erase(20));
+    EXPECT_FALSE(int_list.erase(20));
+    EXPECT_FALSE(int_list.contains(20));
+    EXPECT_EQ(2, int_list.size());
+    EXPECT_TRUE(check_level_0({10, 30}));
+}
+
+TEST_F(CompactSkipListTest, Erase_SlotsAreReused)
+{
+    for (int i = 0; i < 1000; ++i)
+    {
+        int_list.insert(i);
+    }
+    std::size_t memory = int_list.memory_usage();
+
+    for (int round = 0; round < 10; ++round)
+    {
+        for (int i = 0; i < 1000; i += 2)
+        {
+            ASSERT_TRUE(int_list.erase(i));
+        }
+        for (int i = 0; i < 1000; i += 2)
+        {
+            int_list.insert(i);
+        }
+    }
+
+    EXPECT_EQ(1000, int_list.size());
+    EXPECT_LE(int_list.memory_usage(), 2 * memory);
+    for (int i = 0; i < 1000; ++i)
+    {
+        ASSERT_TRUE(int_list.contains(i));
+    }
+}
+
+TEST_F(CompactSkipListTest, Insert_ReturnsPosition)
+{
+    std::pair<CompactSkipList<int>::iterator, bool> first = int_list.insert(5);
+    EXPECT_TRUE(first.second);
+    EXPECT_EQ(5, *first.first);
+
+    int_list.insert(3);
+    std::pair<CompactSkipList<int>::iterator, bool> again = int_list.insert(5);
+    EXPECT_FALSE(again.second);
+    EXPECT_EQ(first.first, again.first);
+}
+
+TEST(CompactSkipListSlotTest, EraseDestroysValue)
+{
+    {
+        CompactSkipList<Counted> list;
+        for (int i = 0; i < 100; ++i)
+        {
+            list.insert(Counted(i));
+        }
+        EXPECT_EQ(100, Counted::live);
+
+        for (int i = 0; i < 100; i += 2)
+        {
+            ASSERT_TRUE(list.erase(Counted(i)));
+        }
+        EXPECT_EQ(50, Counted::live);
+
+        // A copy holds free slots as well and must not touch their values
+        CompactSkipList<Counted> copy(list);
+        EXPECT_EQ(100, Counted::live);
+        EXPECT_TRUE(copy == list);
+
+        list.insert(Counted(0));
+        EXPECT_EQ(101, Counted::live);
+    }
+    EXPECT_EQ(0, Counted::live);
+}
+
+TEST(CompactSkipListSlotTest, ThrowingCopyKeepsTower)
+{
+    CompactSkipList<Counted> list(1);
+    for (int i = 0; i < 100; ++i)
+    {
+        list.insert(Counted(i));
+    }
+    const std::size_t memory = list.memory_usage();
+
+    // Every failed insert draws a tower; they all go back to the free lists
+    Counted::throw_on_copy = true;
+    for (int i = 0; i < 10000; ++i)
+    {
+        EXPECT_THROW(list.insert(Counted(1000 + i)), std::runtime_error);
+    }
+    Counted::throw_on_copy = false;
+
+    EXPECT_EQ(100, list.size());
+    EXPECT_LT(list.memory_usage() - memory, 4096);
+    for (int i = 100; i < 200; ++i)
+    {
+        list.insert(Counted(i));
+    }
+    EXPECT_EQ(200, list.size());
+    EXPECT_TRUE(list.contains(Counted(150)));
+}
+
+TEST_F(CompactSkipListTest, Iterator_StaysValidAcrossInserts)
+{
+    int_list.insert(10);
+    auto it = int_list.begin();
+
+    for (int i = 11; i < 5000; ++i)
+    {
+        int_list.insert(i);
+    }
+
+    EXPECT_EQ(*it, 10);
+    ++it;
+    EXPECT_EQ(*it, 11);
+}
+
+TEST_F(CompactSkipListTest, CopyAndMove)
+{
+    int_list.insert(1);
+    int_list.insert(2);
+
+    CompactSkipList<int> copied_list(int_list);
+    int_list.insert(3);
+    EXPECT_EQ(2, copied_list.size());
+    EXPECT_FALSE(copied_list.contains(3));
+
+    CompactSkipList<int> moved_list(std::move(int_list));
+    EXPECT_TRUE(int_list.empty());
+    EXPECT_FALSE(int_list.contains(1));
+    EXPECT_EQ(3, moved_list.size());
+
+    int_list.insert(7);
+    EXPECT_TRUE(check_level_0({7}));
+}
+
+TEST_F(CompactSkipListTest, Operators)
+{
+    CompactSkipList<int> other_list;
+    int_list.insert(10);
+    int_list.insert(20);
+    other_list.insert(20);
+    other_list.insert(10);
+
+    EXPECT_TRUE(int_list == other_list);
+
+    other_list.insert(30);
+    EXPECT_TRUE(int_list < other_list);
+    EXPECT_TRUE(other_list > int_list);
+    EXPECT_TRUE(int_list <= other_list);
+    EXPECT_FALSE(int_list >= other_list);
+}
+
+TEST(CompactSkipListDoubleTest, ConstIteration)
+{
+    CompactSkipList<double> list;
+    list.insert(2.5);
+    list.insert(-1.25);
+    list.insert(0.5);
+
+    const CompactSkipList<double>& const_list = list;
+    std::vector<double> actual(const_list.cbegin(), const_list.cend());
+
+    EXPECT_EQ(actual, (std::vector<double>{-1.25, 0.5, 2.5}));
+}
+
+TEST(CompactSkipListLevelTest, SameSeedBuildsSameTowers)
+{
+    CompactSkipList<int> first(42);
+    CompactSkipList<int> second(42);
+    for (int i = 0; i < 1000; ++i)
+    {
+        first.insert(i);
+        second.insert(i);
+    }
+
+    // Link storage is the sum of the tower heights
+    EXPECT_EQ(first.memory_usage(), second.memory_usage());
+    EXPECT_EQ(first.get_current_level(), second.get_current_level());
+}
+
+TEST(CompactSkipListLevelTest, LevelsFollowSize)
+{
+    CompactSkipList<int> list(1);
+    for (int round = 0; round < 50; ++round)
+    {
+        list.clear();
+        for (int i = 0; i < 16; ++i)
+        {
+            list.insert(i);
+        }
+        // Draws are capped near log2(n) + 1
+        ASSERT_LE(list.get_current_level(), 5);
+    }
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        list.insert(i);
+    }
+    EXPECT_GE(list.get_current_level(), 10);
+}
+
+TEST(CompactSkipListLevelTest, ParallelFillsOfSeparateLists)
+{
+    const int lists = 4;
+    std::vector<CompactSkipList<int>> filled;
+    for (int i = 0; i < lists; ++i)
+    {
+        filled.emplace_back(static_cast<std::uint64_t>(i));
+    }
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < lists; ++i)
+    {
+        threads.emplace_back([&filled, i]
+        {
+            for (int key = 0; key < 20000; ++key)
+            {
+                filled[i].insert(key * lists + i);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int i = 0; i < lists; ++i)
+    {
+        EXPECT_EQ(20000u, filled[i].size());
+        EXPECT_TRUE(std::is_sorted(filled[i].begin(), filled[i].end()));
+    }
+}
@@ -0,0 +1,169 @@
+#include "gtest/gtest.h"
+#include "../include/skip_list.h"
+
+#include <cctype>
+#include <functional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    // Orders strings ignoring ASCII case, so "Apple" and "APPLE" are equivalent
+    struct CaseInsensitiveLess
+    {
+        bool operator()(const std::string& a, const std::string& b) const
+        {
+            return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(), [](unsigned char x, unsigned char y)
+            {
+                return std::tolower(x) < std::tolower(y);
+            });
+        }
+    };
+
+    // Has neither operator< nor operator==, only the comparator knows its order
+    struct Record
+    {
+        int id;
+        int payload;
+    };
+
+    struct RecordById
+    {
+        using is_transparent = void;
+
+        bool operator()(const Record& a, const Record& b) const { return a.id < b.id; }
+        bool operator()(const Record& a, int id) const { return a.id < id; }
+        bool operator()(int id, const Record& b) const { return id < b.id; }
+    };
+}
+
+TEST(SkipListCompareTest, GreaterOrdersDescending)
+{
+    SkipList<int, std::greater<int>> list;
+    std::set<int, std::greater<int>> reference;
+
+    for (int i = 0; i < 500; ++i)
+    {
+        int value = (i * 37) % 211;
+        EXPECT_EQ(list.insert(value).second, reference.insert(value).second);
+    }
+    for (int i = 0; i < 211; i += 3)
+    {
+        EXPECT_EQ(list.erase(i), reference.erase(i) == 1);
+    }
+
+    ASSERT_EQ(list.size(), reference.size());
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), reference.begin()));
+    for (int i = 0; i < 211; ++i)
+    {
+        EXPECT_EQ(list.contains(i), reference.count(i) == 1);
+    }
+}
+
+TEST(SkipListCompareTest, BulkPathsUseComparator)
+{
+    using List = SkipList<int, std::greater<int>>;
+
+    std::vector<int> descending = {9, 7, 7, 5, 3, 1};
+    List built(descending.begin(), descending.end(), std::greater<int>());
+    EXPECT_EQ(5u, built.size());
+
+    std::vector<int> batch = {2, 8, 4, 4, 6, 9};
+    EXPECT_EQ(4u, built.insert_range(batch.begin(), batch.end()));
+
+    std::vector<int> expected = {9, 8, 7, 6, 5, 4, 3, 2, 1};
+    EXPECT_TRUE(std::equal(built.begin(), built.end(), expected.begin(), expected.end()));
+
+    List copy(built);
+    EXPECT_TRUE(copy.insert(10).second);
+    EXPECT_EQ(10, *copy.begin());
+}
+
+TEST(SkipListCompareTest, EquivalenceComesFromComparator)
+{
+    SkipList<std::string, CaseInsensitiveLess> list;
+
+    EXPECT_TRUE(list.insert("Apple").second);
+    EXPECT_TRUE(list.insert("banana").second);
+
+    std::pair<decltype(list)::iterator, bool> result = list.insert("APPLE");
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ("Apple", *result.first);
+
+    EXPECT_TRUE(list.contains("aPPLE"));
+    EXPECT_TRUE(list.erase("BANANA"));
+    EXPECT_EQ(1u, list.size());
+}
+
+TEST(SkipListCompareTest, TypeWithoutOperators)
+{
+    SkipList<Record, RecordById> list;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        list.insert(Record{i, i * i});
+    }
+    EXPECT_FALSE(list.insert(Record{5, 0}).second);
+
+    // Looked up by id alone
+    EXPECT_TRUE(list.contains(42));
+    EXPECT_FALSE(list.contains(100));
+    EXPECT_TRUE(list.erase(42));
+    EXPECT_FALSE(list.erase(42));
+
+    std::pair<decltype(list)::iterator, bool> result = list.try_emplace(7, Record{7, -1});
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(49, result.first->payload);
+    EXPECT_EQ(99u, list.size());
+}
+
+TEST(SkipListCompareTest, TransparentStringLookup)
+{
+    SkipList<std::string> list;
+    list.insert("alpha");
+    list.insert("beta");
+    list.insert("gamma");
+
+    const std::string_view beta = "beta";
+    EXPECT_TRUE(list.contains(beta));
+    EXPECT_TRUE(list.contains("gamma"));
+    EXPECT_FALSE(list.contains(std::string_view("delta")));
+
+    EXPECT_TRUE(list.erase(beta));
+    EXPECT_FALSE(list.contains(beta));
+    EXPECT_EQ(2u, list.size());
+}
+
+TEST(SkipListCompareTest, StringPrefixCacheTakesStringViews)
+{
+    SkipList<std::string, std::less<>, std::allocator<std::string>, StringPrefixKeyCache> list;
+    for (int i = 0; i < 1000; ++i)
+    {
+        list.insert("shared_prefix_" + std::to_string(i));
+    }
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        const std::string key = "shared_prefix_" + std::to_string(i);
+        ASSERT_TRUE(list.contains(std::string_view(key)));
+        ASSERT_FALSE(list.contains(std::string_view(key + "x")));
+    }
+    for (int i = 0; i < 1000; i += 2)
+    {
+        const std::string key = "shared_prefix_" + std::to_string(i);
+        ASSERT_TRUE(list.erase(std::string_view(key)));
+    }
+    EXPECT_EQ(500u, list.size());
+}
+
+TEST(SkipListCompareTest, KeyCompIsStored)
+{
+    std::greater<int> compare;
+    SkipList<int, std::greater<int>> list(compare);
+    EXPECT_TRUE(list.key_comp()(2, 1));
+
+    SkipList<int, std::greater<int>> moved(std::move(list));
+    EXPECT_TRUE(moved.key_comp()(2, 1));
+}
@@ -1,6 +1,12 @@
 #include "gtest/gtest.h"
 #include "../include/skip_list.h"
 
+#include <forward_list>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
 TEST(SkipListCopyConstructor, EmptyList)
 {   
     SkipList<int> list;
@@ -51,6 +57,135 @@ TEST(SkipListCopyConstructor, CopyThenChange)
     EXPECT_FALSE(list == copied_list); 
 }
 
+TEST(SkipListCopyConstructor, CopiesTowerHeights)
+{
+    SkipList<int> list(11);
+    for (int i = 0; i < 5000; ++i)
+    {
+        list.insert(i);
+    }
+
+    SkipList<int> copied_list(list);
+
+    EXPECT_EQ(copied_list.get_current_level(), list.get_current_level());
+    EXPECT_EQ(copied_list.average_search_length(), list.average_search_length());
+    const Node<int>* source = list.get_first_node_at_0();
+    const Node<int>* copy = copied_list.get_first_node_at_0();
+    for (; source != nullptr; source = source->next(0), copy = copy->next(0))
+    {
+        ASSERT_NE(copy, nullptr);
+        EXPECT_EQ(source->getValue(), copy->getValue());
+        EXPECT_EQ(source->level, copy->level);
+    }
+    EXPECT_EQ(copy, nullptr);
+}
+
+TEST(SkipListCopyConstructor, CopyOfRebalancedListKeepsItsShape)
+{
+    SkipList<int> list(12);
+    for (int i = 0; i < 5000; ++i)
+    {
+        list.insert(i);
+    }
+    for (int i = 0; i < 5000; i += 2)
+    {
+        list.erase(i);
+    }
+    list.rebalance();
+
+    // Towers of the copy are only as tall as the levels they are linked on
+    SkipList<int> copied_list(list);
+    EXPECT_EQ(copied_list.average_search_length(), list.average_search_length());
+    EXPECT_LE(copied_list.memory_usage(), list.memory_usage());
+
+    copied_list.insert(0);
+    copied_list.erase(1);
+    EXPECT_TRUE(copied_list.contains(0));
+    EXPECT_FALSE(copied_list.contains(1));
+    EXPECT_TRUE(list.contains(1));
+    for (int i = 3; i < 5000; i += 2)
+    {
+        ASSERT_TRUE(copied_list.contains(i));
+    }
+}
+
+// SORTED RANGE
+
+TEST(SkipListRangeConstructor, BuildsFromSortedRange)
+{
+    std::vector<int> values;
+    for (int i = 0; i < (1 << 16); ++i)
+    {
+        values.push_back(i * 3);
+    }
+
+    SkipList<int> list(values.begin(), values.end());
+
+    EXPECT_EQ(values.size(), list.size());
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), values.begin(), values.end()));
+    EXPECT_GT(list.get_current_level(), 10);
+    for (int i = 0; i < (1 << 16) * 3; i += 7)
+    {
+        ASSERT_EQ(i % 3 == 0, list.contains(i));
+    }
+
+    // Later inserts and erasures work on the bulk-built towers
+    list.insert(1);
+    EXPECT_TRUE(list.erase(3));
+    EXPECT_TRUE(list.contains(1));
+    EXPECT_FALSE(list.contains(3));
+    EXPECT_EQ(values.size(), list.size());
+}
+
+TEST(SkipListRangeConstructor, SkipsDuplicates)
+{
+    std::forward_list<std::string> words = {"Apple", "Apple", "Banana", "Cherry", "Cherry", "Cherry", "Demon"};
+
+    SkipList<std::string> list(words.begin(), words.end());
+
+    EXPECT_EQ(4, list.size());
+    EXPECT_EQ((std::vector<std::string>{"Apple", "Banana", "Cherry", "Demon"}),
+              std::vector<std::string>(list.begin(), list.end()));
+}
+
+TEST(SkipListRangeConstructor, AcceptsSinglePassInput)
+{
+    std::istringstream input("1 2 2 5 8 13");
+
+    SkipList<int> list(std::istream_iterator<int>(input), std::istream_iterator<int>{});
+
+    EXPECT_EQ((std::vector<int>{1, 2, 5, 8, 13}), std::vector<int>(list.begin(), list.end()));
+}
+
+TEST(SkipListRangeConstructor, AssignReplacesContents)
+{
+    SkipList<int> list;
+    for (int i = 100; i > 0; --i)
+    {
+        list.insert(i);
+    }
+    list.set_recycle_limit(1 << 20);
+
+    std::vector<int> values = {-5, 0, 42};
+    list.assign(values.begin(), values.end());
+    EXPECT_EQ(values, std::vector<int>(list.begin(), list.end()));
+
+    SkipList<int> copy(list.begin(), list.end());
+    EXPECT_TRUE(copy == list);
+
+    list.assign(values.end(), values.end());
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(0, list.get_current_level());
+}
+
+#ifndef NDEBUG
+TEST(SkipListRangeConstructorDeathTest, RejectsUnsortedRange)
+{
+    std::vector<int> values = {1, 3, 2};
+    EXPECT_DEATH(SkipList<int>(values.begin(), values.end()), "not sorted");
+}
+#endif
+
 // MOVE
 
 TEST(SkipListMoveConstructor, EmptyList)
@@ -0,0 +1,86 @@
+#ifndef COUNTING_ALLOCATOR_H
+#define COUNTING_ALLOCATOR_H
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+// Allocator and memory resource that forward to the usual heap and count what passes
+// through, shared by the tests that check how containers allocate.
+
+namespace test_support
+{
+    struct AllocationCounter
+    {
+        std::size_t allocations = 0;
+        std::size_t deallocations = 0;
+
+        // Blocks handed out and not returned yet
+        std::size_t live() const { return allocations - deallocations; }
+    };
+
+    // Forwards to std::allocator. Copies and rebound copies share one counter.
+    template <typename T>
+    struct CountingAllocator
+    {
+        using value_type = T;
+
+        std::shared_ptr<AllocationCounter> counter;
+
+        CountingAllocator() : counter(std::make_shared<AllocationCounter>()) {}
+
+        template <typename U>
+        CountingAllocator(const CountingAllocator<U>& other) noexcept : counter(other.counter) {}
+
+        T* allocate(std::size_t n)
+        {
+            T* p = std::allocator<T>().allocate(n);
+            counter->allocations++;
+            return p;
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            counter->deallocations++;
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        template <typename U>
+        bool operator==(const CountingAllocator<U>& other) const { return counter == other.counter; }
+
+        template <typename U>
+        bool operator!=(const CountingAllocator<U>& other) const { return counter != other.counter; }
+    };
+
+    // Forwards to an upstream resource
+    class CountingResource : public std::pmr::memory_resource
+    {
+        public:
+            AllocationCounter counter;
+
+            explicit CountingResource(std::pmr::memory_resource* _upstream = std::pmr::new_delete_resource()) : upstream(_upstream) {}
+
+        private:
+            std::pmr::memory_resource* upstream;
+
+            void* do_allocate(std::size_t bytes, std::size_t alignment) override
+            {
+                void* p = upstream->allocate(bytes, alignment);
+                counter.allocations++;
+                return p;
+            }
+
+            void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+            {
+                counter.deallocations++;
+                upstream->deallocate(p, bytes, alignment);
+            }
+
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+            {
+                return this == &other;
+            }
+    };
+}
+
+#endif
@@ -0,0 +1,214 @@
+#include "gtest/gtest.h"
+#include "../include/deterministic_skip_list.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory_resource>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+TEST(DeterministicSkipListTest, Initialization)
+{
+    DeterministicSkipList<int> list;
+
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(0, list.get_current_level());
+    EXPECT_TRUE(list.begin() == list.end());
+    EXPECT_FALSE(list.contains(1));
+    EXPECT_FALSE(list.erase(1));
+}
+
+TEST(DeterministicSkipListTest, Insert_SortedIterationAndDuplicates)
+{
+    DeterministicSkipList<int> list;
+    for (int value : {13, 5, 1, 22, 110, 79, 5, 1, 64, 8})
+    {
+        list.insert(value);
+    }
+
+    std::vector<int> actual(list.begin(), list.end());
+    EXPECT_EQ(actual, (std::vector<int>{1, 5, 8, 13, 22, 64, 79, 110}));
+    EXPECT_EQ(8, list.size());
+}
+
+TEST(DeterministicSkipListTest, HeightIsLogarithmic)
+{
+    // Sorted input is the worst case for a randomized list's luck, not for this one
+    DeterministicSkipList<int> list;
+    const int count = 1 << 16;
+    for (int i = 0; i < count; ++i)
+    {
+        list.insert(i);
+        ASSERT_LE(list.get_current_level(), std::log2(i + 1) + 2);
+    }
+
+    for (int i = 0; i < count; ++i)
+    {
+        if (i % 16 != 0)
+        {
+            ASSERT_TRUE(list.erase(i));
+        }
+    }
+    EXPECT_EQ(count / 16, list.size());
+    EXPECT_LE(list.get_current_level(), std::log2(count / 16) + 2);
+}
+
+TEST(DeterministicSkipListTest, RandomOperations_MatchStdSet)
+{
+    DeterministicSkipList<int> list;
+    std::set<int> reference;
+    std::mt19937 gen(3);
+
+    for (int step = 0; step < 50000; ++step)
+    {
+        int value = static_cast<int>(gen() % 500);
+        if (gen() % 3 == 0)
+        {
+            ASSERT_EQ(list.erase(value), reference.erase(value) == 1);
+        }
+        else
+        {
+            list.insert(value);
+            reference.insert(value);
+        }
+        ASSERT_EQ(list.contains(value), reference.count(value) == 1);
+    }
+
+    ASSERT_EQ(list.size(), reference.size());
+    EXPECT_TRUE(std::equal(list.cbegin(), list.cend(), reference.begin(), reference.end()));
+
+    for (int value : std::vector<int>(reference.begin(), reference.end()))
+    {
+        ASSERT_TRUE(list.erase(value));
+        ASSERT_FALSE(list.contains(value));
+    }
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(0, list.get_current_level());
+}
+
+TEST(DeterministicSkipListTest, Strings_CopyAndMove)
+{
+    DeterministicSkipList<std::string> list;
+    for (const char* word : {"Witch", "Apple", "Demon", "Banana", "Cherry", "Helicopter"})
+    {
+        list.insert(word);
+    }
+
+    DeterministicSkipList<std::string> copied_list(list);
+    EXPECT_TRUE(copied_list == list);
+
+    list.erase("Apple");
+    EXPECT_TRUE(copied_list.contains("Apple"));
+    EXPECT_TRUE(copied_list < list);
+
+    DeterministicSkipList<std::string> moved_list(std::move(list));
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(*moved_list.begin(), "Banana");
+    EXPECT_EQ(5, moved_list.size());
+
+    list = copied_list;
+    EXPECT_TRUE(list == copied_list);
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_TRUE(list.begin() == list.end());
+}
+
+TEST(DeterministicSkipListTest, InsertReturnsPositionAndFind)
+{
+    DeterministicSkipList<int> list;
+    std::pair<DeterministicSkipList<int>::iterator, bool> first = list.insert(7);
+    EXPECT_TRUE(first.second);
+    EXPECT_EQ(7, *first.first);
+
+    list.insert(3);
+    list.insert(11);
+    std::pair<DeterministicSkipList<int>::iterator, bool> again = list.insert(7);
+    EXPECT_FALSE(again.second);
+    EXPECT_TRUE(again.first == first.first);
+
+    EXPECT_TRUE(list.find(11) != list.end());
+    EXPECT_EQ(11, *list.find(11));
+    EXPECT_TRUE(list.find(8) == list.end());
+
+    const DeterministicSkipList<int>& view = list;
+    EXPECT_EQ(3, *view.find(3));
+    EXPECT_TRUE(view.find(0) == view.end());
+}
+
+TEST(DeterministicSkipListTest, IteratorsSurviveOtherUpdates)
+{
+    // Splits and merges only rewrite the keys above level 0, so an iterator
+    // keeps pointing at its element until that element is erased
+    DeterministicSkipList<int> list;
+    std::map<int, DeterministicSkipList<int>::iterator> positions;
+    std::mt19937 gen(5);
+
+    for (int step = 0; step < 20000; ++step)
+    {
+        int value = static_cast<int>(gen() % 300);
+        if (gen() % 3 == 0)
+        {
+            list.erase(value);
+            positions.erase(value);
+        }
+        else
+        {
+            positions.emplace(value, list.insert(value).first);
+        }
+
+        if (step % 100 == 0)
+        {
+            for (const auto& [key, it] : positions)
+            {
+                ASSERT_EQ(key, *it);
+            }
+        }
+    }
+    ASSERT_EQ(positions.size(), list.size());
+}
+
+TEST(DeterministicSkipListTest, ClearedListIsReusable)
+{
+    DeterministicSkipList<int> list;
+    for (int round = 0; round < 3; ++round)
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            list.insert(i * 7 % 1000);
+        }
+        EXPECT_EQ(1000, list.size());
+
+        list.clear();
+        EXPECT_TRUE(list.empty());
+        EXPECT_EQ(0, list.get_current_level());
+        EXPECT_TRUE(list.begin() == list.end());
+        EXPECT_FALSE(list.contains(0));
+    }
+}
+
+TEST(DeterministicSkipListTest, NodesComeFromAllocator)
+{
+    std::pmr::monotonic_buffer_resource arena;
+    std::pmr::set_default_resource(std::pmr::null_memory_resource());
+
+    DeterministicSkipList<std::pmr::string, std::pmr::polymorphic_allocator<std::pmr::string>> list(&arena);
+    const std::string prefix = "a key long enough to leave the small buffer ";
+    for (int i = 0; i < 200; ++i)
+    {
+        // Longer than the small string buffer, so the strings allocate too
+        list.insert(std::pmr::string(prefix + std::to_string(i), &arena));
+    }
+    EXPECT_EQ(200, list.size());
+    EXPECT_TRUE(list.contains(std::pmr::string(prefix + "42", &arena)));
+    EXPECT_EQ(&arena, list.begin()->get_allocator().resource());
+
+    DeterministicSkipList<std::pmr::string, std::pmr::polymorphic_allocator<std::pmr::string>> copy(list, &arena);
+    EXPECT_TRUE(copy == list);
+    list.clear();
+    EXPECT_TRUE(list.empty());
+
+    std::pmr::set_default_resource(nullptr);
+}
@@ -0,0 +1,145 @@
+#include "gtest/gtest.h"
+#include "../include/skip_list.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    // Counts how often a value is constructed from a key
+    struct Counted
+    {
+        static int constructions;
+
+        int key;
+
+        explicit Counted(int k) : key(k) { constructions++; }
+
+        bool operator<(const Counted& other) const { return key < other.key; }
+        bool operator==(const Counted& other) const { return key == other.key; }
+        friend bool operator<(const Counted& value, int k) { return value.key < k; }
+        friend bool operator<(int k, const Counted& value) { return k < value.key; }
+    };
+
+    int Counted::constructions = 0;
+
+    struct MoveOnly
+    {
+        int key;
+        std::unique_ptr<std::string> payload;
+
+        MoveOnly(int k, std::string text) : key(k), payload(std::make_unique<std::string>(std::move(text))) {}
+        MoveOnly(MoveOnly&&) noexcept = default;
+        MoveOnly& operator=(MoveOnly&&) noexcept = default;
+
+        bool operator<(const MoveOnly& other) const { return key < other.key; }
+        bool operator==(const MoveOnly& other) const { return key == other.key; }
+    };
+}
+
+TEST(SkipListEmplaceTest, InsertReportsWhetherValueWasNew)
+{
+    SkipList<int> list;
+
+    auto [first, inserted] = list.insert(5);
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(5, *first);
+
+    list.insert(1);
+    list.insert(9);
+    auto [again, inserted_again] = list.insert(5);
+    EXPECT_FALSE(inserted_again);
+    EXPECT_TRUE(again == first);
+    EXPECT_EQ(9, *++again);
+    EXPECT_EQ(3, list.size());
+}
+
+TEST(SkipListEmplaceTest, RvalueInsertMovesOnlyNewValues)
+{
+    SkipList<std::string> list;
+    std::string long_value(100, 'a');
+    std::string duplicate = long_value;
+
+    EXPECT_TRUE(list.insert(std::move(long_value)).second);
+    EXPECT_TRUE(long_value.empty());
+
+    // A duplicate is left alone
+    EXPECT_FALSE(list.insert(std::move(duplicate)).second);
+    EXPECT_EQ(100, duplicate.size());
+    EXPECT_EQ(1, list.size());
+}
+
+TEST(SkipListEmplaceTest, EmplaceConstructsFromArguments)
+{
+    SkipList<std::string, std::less<>, std::allocator<std::string>, StringPrefixKeyCache> list;
+
+    auto [it, inserted] = list.emplace(5, 'x');
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ("xxxxx", *it);
+
+    EXPECT_FALSE(list.emplace("xxxxx").second);
+    EXPECT_TRUE(list.emplace("xxxxxy").second);
+    EXPECT_EQ((std::vector<std::string>{"xxxxx", "xxxxxy"}), std::vector<std::string>(list.begin(), list.end()));
+}
+
+TEST(SkipListEmplaceTest, TryEmplaceConstructsOnlyNewValues)
+{
+    SkipList<Counted> list;
+    Counted::constructions = 0;
+
+    EXPECT_TRUE(list.try_emplace(4).second);
+    EXPECT_TRUE(list.try_emplace(2, 2).second);
+    EXPECT_EQ(2, Counted::constructions);
+
+    auto [it, inserted] = list.try_emplace(4);
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(4, it->key);
+    EXPECT_EQ(2, Counted::constructions);
+    EXPECT_EQ(2, list.size());
+}
+
+TEST(SkipListEmplaceTest, TryEmplaceWithStringKeys)
+{
+    SkipList<std::string, std::less<>, std::allocator<std::string>, StringPrefixKeyCache> list;
+    list.insert("Banana");
+
+    EXPECT_TRUE(list.try_emplace("Apple").second);
+    EXPECT_FALSE(list.try_emplace(std::string_view("Banana")).second);
+    EXPECT_TRUE(list.try_emplace(std::string_view("Cherry")).second);
+
+    EXPECT_TRUE(list.contains("Apple"));
+    EXPECT_TRUE(list.contains("Cherry"));
+    EXPECT_EQ((std::vector<std::string>{"Apple", "Banana", "Cherry"}), std::vector<std::string>(list.begin(), list.end()));
+}
+
+TEST(SkipListEmplaceTest, MoveOnlyValues)
+{
+    SkipList<MoveOnly> list;
+    for (int i = 10; i > 0; --i)
+    {
+        EXPECT_TRUE(list.emplace(i, "value " + std::to_string(i)).second);
+    }
+    EXPECT_TRUE(list.insert(MoveOnly(0, "zero")).second);
+    EXPECT_FALSE(list.emplace(5, "again").second);
+
+    EXPECT_EQ(11, list.size());
+    EXPECT_EQ("value 5", *list.insert(MoveOnly(5, "ignored")).first->payload);
+    EXPECT_TRUE(list.erase(MoveOnly(3, "")));
+    EXPECT_FALSE(list.contains(MoveOnly(3, "")));
+
+    list.compact();
+    SkipList<MoveOnly> moved(std::move(list));
+    SkipList<MoveOnly> target;
+    target = std::move(moved);
+
+    int expected[] = {0, 1, 2, 4, 5, 6, 7, 8, 9, 10};
+    int index = 0;
+    for (const MoveOnly& value : target)
+    {
+        EXPECT_EQ(expected[index++], value.key);
+    }
+    EXPECT_EQ(10, index);
+}
@@ -0,0 +1,75 @@
+#include "gtest/gtest.h"
+#include "../include/skip_list.h"
+
+#include <random>
+#include <set>
+#include <string>
+
+TEST(KeyCacheTest, StringPrefix_OrdersLikeStrings)
+{
+    using Cache = StringPrefixKeyCache;
+
+    EXPECT_LT(Cache::compare(Cache::make("ab"), Cache::make("ab\x01")), 0);
+    EXPECT_LT(Cache::compare(Cache::make("Apple"), Cache::make("Banana")), 0);
+    EXPECT_GT(Cache::compare(Cache::make("\xff"), Cache::make("a")), 0);
+    EXPECT_EQ(Cache::compare(Cache::make("prefix__1"), Cache::make("prefix__2")), 0);
+    EXPECT_EQ(Cache::make(""), 0u);
+}
+
+TEST(KeyCacheTest, CopyCache_RandomOperationsMatchStdSet)
+{
+    SkipList<int, std::less<>, std::allocator<int>, CopyKeyCache<int>> list;
+    std::set<int> reference;
+    std::mt19937 gen(5);
+
+    for (int step = 0; step < 20000; ++step)
+    {
+        int value = static_cast<int>(gen() % 1000);
+        if (gen() % 3 == 0)
+        {
+            ASSERT_EQ(list.erase(value), reference.erase(value) == 1);
+        }
+        else
+        {
+            list.insert(value);
+            reference.insert(value);
+        }
+        ASSERT_EQ(list.contains(value), reference.count(value) == 1);
+    }
+
+    ASSERT_EQ(list.size(), reference.size());
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), reference.begin()));
+
+    // Every level 0 link caches the value of the node it points to
+    for (auto* node = list.get_first_node_at_0(); node->next(0) != nullptr; node = node->next(0))
+    {
+        ASSERT_EQ(node->key(0), node->next(0)->getValue());
+    }
+}
+
+TEST(KeyCacheTest, StringPrefix_SharedPrefixes)
+{
+    SkipList<std::string, std::less<>, std::allocator<std::string>, StringPrefixKeyCache> list;
+
+    for (int i = 0; i < 500; ++i)
+    {
+        list.insert("common_prefix_" + std::to_string(i));
+        list.insert(std::to_string(i));
+    }
+    for (int i = 0; i < 500; i += 2)
+    {
+        ASSERT_TRUE(list.erase("common_prefix_" + std::to_string(i)));
+    }
+
+    EXPECT_EQ(750, list.size());
+    EXPECT_TRUE(list.contains("common_prefix_1"));
+    EXPECT_FALSE(list.contains("common_prefix_2"));
+    EXPECT_TRUE(list.contains("42"));
+    EXPECT_FALSE(list.contains("common_prefix_"));
+    EXPECT_TRUE(std::is_sorted(list.begin(), list.end()));
+
+    for (auto* node = list.get_first_node_at_0(); node->next(0) != nullptr; node = node->next(0))
+    {
+        ASSERT_EQ(node->key(0), StringPrefixKeyCache::make(node->next(0)->getValue()));
+    }
+}
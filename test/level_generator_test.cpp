@@ -0,0 +1,108 @@
+#include "gtest/gtest.h"
+#include "../include/level_generator.h"
+#include "../include/skip_list.h"
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+    // Draws from generator and checks every level's frequency against the geometric distribution
+    template <double P>
+    void expect_geometric(std::size_t max_level)
+    {
+        const std::size_t draws = 1000000;
+        LevelGenerator<P> generator(42);
+        std::vector<std::size_t> counts(max_level + 1, 0);
+
+        for (std::size_t i = 0; i < draws; ++i)
+        {
+            std::size_t level = generator(max_level);
+            ASSERT_LE(level, max_level);
+            counts[level]++;
+        }
+
+        double total = 0.0;
+        for (std::size_t level = 0; level <= max_level; ++level)
+        {
+            double expected = draws * LevelGenerator<P>::probability(level, max_level);
+            total += LevelGenerator<P>::probability(level, max_level);
+
+            // Five standard deviations of a binomial count
+            double tolerance = 5.0 * std::sqrt(expected) + 1.0;
+            EXPECT_NEAR(static_cast<double>(counts[level]), expected, tolerance) << "level " << level;
+        }
+        EXPECT_NEAR(total, 1.0, 1e-12);
+    }
+}
+
+TEST(LevelGeneratorTest, HalfIsGeometric)
+{
+    expect_geometric<0.5>(16);
+}
+
+TEST(LevelGeneratorTest, QuarterIsGeometric)
+{
+    expect_geometric<0.25>(16);
+}
+
+TEST(LevelGeneratorTest, InverseEIsGeometric)
+{
+    expect_geometric<INVERSE_E>(16);
+}
+
+TEST(LevelGeneratorTest, LowCapTakesTheTail)
+{
+    expect_geometric<0.5>(3);
+}
+
+TEST(LevelGeneratorTest, SameSeedSameSequence)
+{
+    LevelGenerator<0.5> first(7);
+    LevelGenerator<0.5> second(7);
+    LevelGenerator<0.5> other(8);
+
+    bool differs = false;
+    for (int i = 0; i < 1000; ++i)
+    {
+        std::size_t level = first(16);
+        EXPECT_EQ(level, second(16));
+        differs |= level != other(16);
+    }
+    EXPECT_TRUE(differs);
+}
+
+TEST(LevelPolicyTest, QuarterWithThirtyTwoLevels)
+{
+    SkipList<int, std::less<>, std::allocator<int>, NoKeyCache, LevelPolicy<0.25, 32>> list;
+    for (int i = 0; i < 10000; ++i)
+    {
+        list.insert((i * 7919) % 10000);
+    }
+
+    EXPECT_EQ(list.height_stats().size(), 33);
+    EXPECT_LE(list.get_current_level(), 32);
+    EXPECT_GT(list.height_stats()[0].nodes, 10000 * 7 / 10);
+    for (int i = 0; i < 10000; ++i)
+    {
+        EXPECT_TRUE(list.contains(i));
+    }
+    EXPECT_TRUE(list.erase(5000));
+    EXPECT_FALSE(list.contains(5000));
+}
+
+TEST(LevelPolicyTest, InverseEWithFourLevels)
+{
+    SkipList<int, std::less<>, std::allocator<int>, NoKeyCache, LevelPolicy<INVERSE_E, 4>> list;
+    list.reserve(1000);
+    for (int i = 1000; i > 0; --i)
+    {
+        list.insert(i);
+    }
+
+    EXPECT_EQ(list.height_stats().size(), 5);
+    EXPECT_LE(list.get_current_level(), 4);
+    EXPECT_EQ(list.size(), 1000);
+    EXPECT_EQ(*list.begin(), 1);
+}
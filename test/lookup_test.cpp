@@ -0,0 +1,111 @@
+#include "gtest/gtest.h"
+#include "../include/skip_list.h"
+
+#include <functional>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+
+TEST(SkipListLookupTest, MatchesStdSet)
+{
+    SkipList<int> list;
+    std::set<int> reference;
+    std::mt19937 gen(11);
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        int value = static_cast<int>(gen() % 5000) * 2;
+        list.insert(value);
+        reference.insert(value);
+    }
+
+    for (int key = -3; key < 10003; ++key)
+    {
+        SkipList<int>::iterator found = list.find(key);
+        ASSERT_EQ(found == list.end(), reference.find(key) == reference.end());
+        if (found != list.end())
+        {
+            ASSERT_EQ(key, *found);
+        }
+
+        std::set<int>::iterator lower = reference.lower_bound(key);
+        std::set<int>::iterator upper = reference.upper_bound(key);
+        ASSERT_EQ(std::distance(list.begin(), list.lower_bound(key)), std::distance(reference.begin(), lower));
+        ASSERT_EQ(std::distance(list.begin(), list.upper_bound(key)), std::distance(reference.begin(), upper));
+
+        std::pair<SkipList<int>::iterator, SkipList<int>::iterator> range = list.equal_range(key);
+        ASSERT_EQ(std::distance(range.first, range.second), std::distance(lower, upper));
+        ASSERT_EQ(range.first, list.lower_bound(key));
+    }
+}
+
+TEST(SkipListLookupTest, ConstOverloads)
+{
+    SkipList<int> list;
+    for (int i = 0; i < 100; i += 10)
+    {
+        list.insert(i);
+    }
+    const SkipList<int>& view = list;
+
+    SkipList<int>::const_iterator found = view.find(30);
+    ASSERT_NE(view.end(), found);
+    EXPECT_EQ(30, *found);
+    EXPECT_EQ(view.end(), view.find(35));
+
+    EXPECT_EQ(40, *view.lower_bound(35));
+    EXPECT_EQ(40, *view.upper_bound(30));
+    EXPECT_EQ(view.end(), view.lower_bound(91));
+    EXPECT_EQ(view.end(), view.upper_bound(90));
+
+    std::pair<SkipList<int>::const_iterator, SkipList<int>::const_iterator> range = view.equal_range(50);
+    EXPECT_EQ(50, *range.first);
+    EXPECT_EQ(60, *range.second);
+}
+
+TEST(SkipListLookupTest, EmptyList)
+{
+    SkipList<int> list;
+    EXPECT_EQ(list.end(), list.find(1));
+    EXPECT_EQ(list.end(), list.lower_bound(1));
+    EXPECT_EQ(list.end(), list.upper_bound(1));
+    EXPECT_EQ(list.equal_range(1).first, list.equal_range(1).second);
+}
+
+TEST(SkipListLookupTest, RangeScanFromLowerBound)
+{
+    SkipList<std::string, std::less<>, std::allocator<std::string>, StringPrefixKeyCache> list;
+    for (int i = 0; i < 300; ++i)
+    {
+        list.insert("user:" + std::to_string(1000 + i));
+        list.insert("order:" + std::to_string(1000 + i));
+    }
+
+    // Every "order:" key, found from a string_view seek without building a string
+    std::size_t orders = 0;
+    for (auto it = list.lower_bound(std::string_view("order:")); it != list.end() && it->starts_with("order:"); ++it)
+    {
+        orders++;
+    }
+    EXPECT_EQ(300u, orders);
+
+    EXPECT_EQ("user:1000", *list.upper_bound(std::string_view("order:1299")));
+    EXPECT_EQ("user:1042", *list.find("user:1042"));
+    EXPECT_EQ(list.end(), list.find(std::string_view("user:")));
+}
+
+TEST(SkipListLookupTest, FollowsComparator)
+{
+    SkipList<int, std::greater<int>> list;
+    for (int i = 0; i < 10; ++i)
+    {
+        list.insert(i * 10);
+    }
+
+    EXPECT_EQ(30, *list.lower_bound(35));
+    EXPECT_EQ(30, *list.upper_bound(40));
+    EXPECT_EQ(list.end(), list.lower_bound(-1));
+    EXPECT_EQ(90, *list.find(90));
+}
@@ -0,0 +1,51 @@
+#include "gtest/gtest.h"
+#include "../include/skip_list.h"
+
+#include <string>
+
+TEST(NodeTest, AllocationSize_OnePointerPerLevel)
+{
+    EXPECT_EQ(Node<int>::allocation_size(1) - Node<int>::allocation_size(0), sizeof(Node<int>*));
+    EXPECT_EQ(Node<int>::allocation_size(5) - Node<int>::allocation_size(0), 5 * sizeof(Node<int>*));
+}
+
+TEST(NodeTest, AllocationSize_SmallValueIsCompact)
+{
+    // value + level share one word, followed by a single forward pointer
+    EXPECT_LE(Node<int>::allocation_size(0), 2 * sizeof(void*));
+    EXPECT_GE(Node<std::string>::allocation_size(0), sizeof(std::string) + sizeof(void*));
+}
+
+TEST(NodeTest, Links_FollowLevelZeroInOrder)
+{
+    SkipList<std::string> list;
+    list.insert("b");
+    list.insert("a");
+    list.insert("c");
+
+    Node<std::string>* first = list.get_first_node_at_0();
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first->getValue(), "a");
+    ASSERT_NE(first->next(0), nullptr);
+    EXPECT_EQ(first->next(0)->getValue(), "b");
+    EXPECT_EQ(first->next(0)->next(0)->getValue(), "c");
+    EXPECT_EQ(first->next(0)->next(0)->next(0), nullptr);
+}
+
+TEST(NodeTest, LargeList_InsertEraseAndDestroy)
+{
+    SkipList<int> list;
+    for (int i = 0; i < 100000; ++i)
+    {
+        list.insert(i);
+    }
+    for (int i = 0; i < 100000; i += 2)
+    {
+        EXPECT_TRUE(list.erase(i));
+    }
+
+    EXPECT_EQ(list.size(), 50000);
+    EXPECT_FALSE(list.contains(0));
+    EXPECT_TRUE(list.contains(1));
+    EXPECT_TRUE(list.contains(99999));
+}
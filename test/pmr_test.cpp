@@ -0,0 +1,106 @@
+#include "gtest/gtest.h"
+#include "../include/skip_list.h"
+#include "counting_allocator.h"
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+using test_support::CountingResource;
+
+namespace
+{
+    // Monotonic arena that counts deallocation requests
+    class CountingArena : public std::pmr::monotonic_buffer_resource
+    {
+        public:
+            std::size_t deallocations = 0;
+
+        protected:
+            void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+            {
+                deallocations++;
+                std::pmr::monotonic_buffer_resource::do_deallocate(p, bytes, alignment);
+            }
+    };
+
+    // Makes any use of the default resource fail for the lifetime of the guard
+    struct NoDefaultResource
+    {
+        std::pmr::memory_resource* previous;
+
+        NoDefaultResource() : previous(std::pmr::set_default_resource(std::pmr::null_memory_resource())) {}
+        ~NoDefaultResource() { std::pmr::set_default_resource(previous); }
+    };
+}
+
+TEST(PmrSkipListTest, NodesComeFromTheResource)
+{
+    CountingResource resource;
+    {
+        NoDefaultResource guard;
+        pmr::SkipList<int> list(&resource);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            list.insert(i);
+        }
+        EXPECT_TRUE(list.erase(50));
+        EXPECT_TRUE(list.contains(99));
+        EXPECT_EQ(list.size(), 99);
+        EXPECT_EQ(list.get_allocator().resource(), &resource);
+    }
+    // 100 nodes, the head and every growth of the head tower
+    EXPECT_GT(resource.counter.allocations, 101);
+    EXPECT_EQ(resource.counter.deallocations, resource.counter.allocations);
+}
+
+TEST(PmrSkipListTest, StringsShareTheResource)
+{
+    CountingResource resource;
+    NoDefaultResource guard;
+    pmr::SkipList<std::pmr::string> list(&resource);
+
+    std::pmr::string first("a string long enough to need a heap buffer", &resource);
+    std::pmr::string second("another string long enough for a heap buffer", &resource);
+    std::size_t before = resource.counter.allocations;
+
+    list.insert(first);
+    list.insert(second);
+
+    EXPECT_EQ(list.begin()->get_allocator().resource(), &resource);
+    EXPECT_EQ(resource.counter.allocations - before, 4); // two nodes, two string buffers
+}
+
+TEST(PmrSkipListTest, MonotonicArenaSkipsDeallocation)
+{
+    CountingArena arena;
+    {
+        pmr::SkipList<std::pmr::string> list(&arena);
+        for (int i = 0; i < 100; ++i)
+        {
+            list.insert(std::pmr::string(std::to_string(i) + " padded to leave the small string buffer", &arena));
+        }
+        EXPECT_EQ(list.size(), 100);
+        arena.deallocations = 0;
+    }
+    // Values return their string buffers, nodes and the head are left to the arena
+    EXPECT_EQ(arena.deallocations, 100);
+}
+
+TEST(PmrSkipListTest, InsertRangeUsesTheResource)
+{
+    CountingResource resource;
+    std::vector<std::string> words;
+    for (int i = 0; i < 100; ++i)
+    {
+        words.push_back(std::to_string(i % 60) + " padded to leave the small string buffer");
+    }
+
+    NoDefaultResource guard;
+    pmr::SkipList<std::pmr::string> list(&resource);
+    EXPECT_EQ(list.insert_range(words.begin(), words.end()), 60);
+    EXPECT_EQ(list.size(), 60);
+    EXPECT_EQ(list.begin()->get_allocator().resource(), &resource);
+}
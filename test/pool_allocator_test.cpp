@@ -0,0 +1,165 @@
+#include "gtest/gtest.h"
+#include "../include/skip_list.h"
+#include "../include/pool_allocator.h"
+
+#include <string>
+
+TEST(NodePoolTest, ReusesFreedBlocks)
+{
+    NodePool pool;
+
+    void* first = pool.allocate(24, 8);
+    pool.deallocate(first, 24, 8);
+    void* second = pool.allocate(24, 8);
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(pool.slab_count(), 1);
+    pool.deallocate(second, 24, 8);
+}
+
+TEST(NodePoolTest, SizeClassesDoNotMix)
+{
+    NodePool pool;
+
+    void* small = pool.allocate(16, 8);
+    pool.deallocate(small, 16, 8);
+    void* large = pool.allocate(32, 8);
+
+    EXPECT_NE(small, large);
+    pool.deallocate(large, 32, 8);
+}
+
+TEST(NodePoolTest, OversizedBlocksBypassSlabs)
+{
+    NodePool pool;
+
+    void* big = pool.allocate(NodePool::MAX_POOLED_SIZE + 1, 8);
+    EXPECT_EQ(pool.slab_count(), 0);
+    pool.deallocate(big, NodePool::MAX_POOLED_SIZE + 1, 8);
+}
+
+TEST(PoolAllocatorTest, InsertEraseContains)
+{
+    SkipList<std::string, std::less<>, PoolAllocator<std::string>> list;
+
+    list.insert("Banana");
+    list.insert("Apple");
+    list.insert("Cherry");
+
+    EXPECT_EQ(list.size(), 3);
+    EXPECT_TRUE(list.erase("Banana"));
+    EXPECT_FALSE(list.contains("Banana"));
+    EXPECT_TRUE(list.contains("Apple"));
+    EXPECT_EQ(*list.begin(), "Apple");
+    EXPECT_GE(list.get_allocator().get_pool().slab_count(), 1);
+}
+
+TEST(PoolAllocatorTest, CopyGetsItsOwnPool)
+{
+    SkipList<int, std::less<>, PoolAllocator<int>> list;
+    list.insert(10);
+    list.insert(20);
+
+    SkipList<int, std::less<>, PoolAllocator<int>> copied_list(list);
+
+    EXPECT_TRUE(list == copied_list);
+    EXPECT_NE(list.get_allocator(), copied_list.get_allocator());
+}
+
+TEST(PoolAllocatorTest, MoveAssignmentTakesPool)
+{
+    SkipList<int, std::less<>, PoolAllocator<int>> list;
+    list.insert(10);
+    list.insert(20);
+    PoolAllocator<int> pool = list.get_allocator();
+
+    SkipList<int, std::less<>, PoolAllocator<int>> other_list;
+    other_list.insert(5);
+    other_list = std::move(list);
+
+    EXPECT_EQ(other_list.get_allocator(), pool);
+    EXPECT_EQ(other_list.size(), 2);
+    EXPECT_TRUE(other_list.contains(20));
+    EXPECT_FALSE(other_list.contains(5));
+
+    EXPECT_TRUE(list.empty());
+    list.insert(1);
+    EXPECT_TRUE(list.contains(1));
+}
+
+TEST(PoolAllocatorTest, CopyAssignmentKeepsPool)
+{
+    SkipList<int, std::less<>, PoolAllocator<int>> list;
+    PoolAllocator<int> pool = list.get_allocator();
+
+    SkipList<int, std::less<>, PoolAllocator<int>> other_list;
+    other_list.insert(1);
+    other_list.insert(2);
+
+    list = other_list;
+
+    EXPECT_EQ(list.get_allocator(), pool);
+    EXPECT_TRUE(list == other_list);
+}
+
+TEST(PoolAllocatorTest, DestructorReleasesExclusivePool)
+{
+    PoolAllocator<std::string> allocator;
+    {
+        SkipList<std::string, std::less<>, PoolAllocator<std::string>> list(allocator);
+        for (int i = 0; i < 1000; ++i)
+        {
+            list.insert(std::string(32, 'a') + std::to_string(i));
+        }
+        EXPECT_GT(allocator.get_pool().slab_count(), 0);
+    }
+    EXPECT_EQ(allocator.get_pool().slab_count(), 0);
+}
+
+TEST(PoolAllocatorTest, DestructorKeepsSharedPool)
+{
+    PoolAllocator<int> allocator;
+    SkipList<int, std::less<>, PoolAllocator<int>> kept_list(allocator);
+    kept_list.insert(1);
+    {
+        SkipList<int, std::less<>, PoolAllocator<int>> list(allocator);
+        list.insert(2);
+    }
+    EXPECT_GT(allocator.get_pool().slab_count(), 0);
+    EXPECT_TRUE(kept_list.contains(1));
+}
+
+TEST(PoolAllocatorTest, HugePageModeServesNodes)
+{
+    SkipList<int, std::less<>, PoolAllocator<int>> list(PoolAllocator<int>(NodePool::PageMode::huge));
+    for (int i = 0; i < 20000; ++i)
+    {
+        list.insert(i);
+    }
+
+    const NodePool& pool = list.get_allocator().get_pool();
+    EXPECT_EQ(pool.get_page_mode(), NodePool::PageMode::huge);
+    EXPECT_TRUE(list.contains(12345));
+    EXPECT_TRUE(list.erase(12345));
+    EXPECT_FALSE(list.contains(12345));
+
+    // Falls back to ordinary slabs where huge pages are unavailable
+    EXPECT_GE(pool.slab_count(), 1);
+    EXPECT_LE(pool.huge_slab_count(), pool.slab_count());
+    if (pool.huge_slab_count() == pool.slab_count())
+    {
+        EXPECT_EQ(pool.slab_count(), 1);
+    }
+}
+
+TEST(PoolAllocatorTest, CopyKeepsPageMode)
+{
+    SkipList<int, std::less<>, PoolAllocator<int>> list(PoolAllocator<int>(NodePool::PageMode::huge));
+    list.insert(1);
+
+    SkipList<int, std::less<>, PoolAllocator<int>> copy(list);
+
+    EXPECT_NE(copy.get_allocator(), list.get_allocator());
+    EXPECT_EQ(copy.get_allocator().get_pool().get_page_mode(), NodePool::PageMode::huge);
+    EXPECT_EQ(PoolAllocator<int>().get_pool().huge_slab_count(), 0);
+}
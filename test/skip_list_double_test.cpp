@@ -9,12 +9,12 @@ class SkipListDoubleTest : public ::testing::Test
         bool check_level_0(const std::vector<double>& expected_elements) 
         {
             std::vector<double> actual_elements;
-            std::shared_ptr<Node<double>> current = double_list.get_first_node_at_0();
+            Node<double>* current = double_list.get_first_node_at_0();
 
             while (current != nullptr) 
             {
                 actual_elements.push_back(current->getValue());
-                current = current->next[0];
+                current = current->next(0);
             }
 
             return expected_elements == actual_elements;
@@ -1,6 +1,13 @@
 #include "gtest/gtest.h"          
 #include "../include/skip_list.h" 
 
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+
 class SkipListIntTest : public ::testing::Test 
 {
     protected:
@@ -10,12 +17,12 @@ class SkipListIntTest : public ::testing::Test
         bool check_level_0(const std::vector<int>& expected_elements) 
         {
             std::vector<int> actual_elements;
-            std::shared_ptr<Node<int>> current = int_list.get_first_node_at_0();
+            Node<int>* current = int_list.get_first_node_at_0();
 
             while (current != nullptr) 
             {
                 actual_elements.push_back(current->getValue());
-                current = current->next[0];
+                current = current->next(0);
             }
 
             return expected_elements == actual_elements;
@@ -292,4 +299,354 @@ TEST_F(SkipListIntTest, Operator_GreaterOrEqual_LessVsGreater)
     
     EXPECT_TRUE(int_list >= other_list);
     EXPECT_FALSE(other_list >= int_list);
-}
\ No newline at end of file
+}
+// CLEAR TESTS
+TEST_F(SkipListIntTest, Clear_RemovesEverything)
+{
+    int_list.insert(10);
+    int_list.insert(20);
+    int_list.insert(30);
+
+    int_list.clear();
+
+    EXPECT_TRUE(int_list.empty());
+    EXPECT_EQ(0, int_list.get_current_level());
+    EXPECT_FALSE(int_list.contains(20));
+    EXPECT_TRUE(check_level_0({}));
+}
+
+TEST_F(SkipListIntTest, Clear_ListStaysUsable)
+{
+    for (int i = 0; i < 1000; ++i)
+    {
+        int_list.insert(i);
+    }
+    int_list.clear();
+
+    int_list.insert(5);
+    int_list.insert(1);
+
+    EXPECT_EQ(2, int_list.size());
+    EXPECT_TRUE(check_level_0({1, 5}));
+}
+
+TEST(SkipListLevelTest, LevelsGrowWithSize)
+{
+    // With 2^20 elements a level above 16 is missing with probability e^-8
+    SkipList<long> list(1);
+    EXPECT_LT(list.memory_usage(), Node<long>::allocation_size(16));
+
+    for (long i = 0; i < (1 << 20); ++i)
+    {
+        list.insert(i);
+    }
+
+    EXPECT_GT(list.get_current_level(), 16);
+    EXPECT_LE(list.get_current_level(), 21);
+    for (long i = 0; i < (1 << 20); i += 997)
+    {
+        EXPECT_TRUE(list.contains(i));
+    }
+    EXPECT_FALSE(list.contains(1 << 20));
+}
+
+TEST(SkipListLevelTest, SmallListsStayShort)
+{
+    SkipList<long> list;
+    for (long i = 0; i < 16; ++i)
+    {
+        list.insert(i);
+    }
+
+    // Draws are capped near log2(n) + 1
+    EXPECT_LE(list.get_current_level(), 5);
+}
+
+TEST(SkipListLevelTest, ClearedListsStayShort)
+{
+    SkipList<long> list(1);
+    for (long i = 0; i < 20000; ++i)
+    {
+        list.insert(i);
+    }
+
+    // The cap starts over with the list, so refills of 16 elements stay near log2(16) + 1
+    for (int round = 0; round < 100; ++round)
+    {
+        list.clear();
+        for (long i = 0; i < 16; ++i)
+        {
+            list.insert(i);
+        }
+        ASSERT_LE(list.get_current_level(), 5);
+    }
+}
+
+TEST(SkipListLevelTest, SameSeedBuildsSameTowers)
+{
+    SkipList<int> first(42);
+    SkipList<int> second(42);
+    SkipList<int> other(43);
+    for (int i = 0; i < 1000; ++i)
+    {
+        first.insert(i);
+        second.insert(i);
+        other.insert(i);
+    }
+
+    bool same_as_other = true;
+    const Node<int>* a = first.get_first_node_at_0();
+    const Node<int>* b = second.get_first_node_at_0();
+    const Node<int>* c = other.get_first_node_at_0();
+    for (; a != nullptr; a = a->next(0), b = b->next(0), c = c->next(0))
+    {
+        EXPECT_EQ(a->level, b->level);
+        same_as_other = same_as_other && a->level == c->level;
+    }
+    EXPECT_FALSE(same_as_other);
+}
+
+TEST(SkipListLevelTest, ParallelFillsOfSeparateLists)
+{
+    const int lists = 4;
+    std::vector<SkipList<int>> filled;
+    for (int i = 0; i < lists; ++i)
+    {
+        filled.emplace_back(static_cast<std::uint64_t>(i));
+    }
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < lists; ++i)
+    {
+        threads.emplace_back([&filled, i]
+        {
+            for (int key = 0; key < 20000; ++key)
+            {
+                filled[i].insert(key * lists + i);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int i = 0; i < lists; ++i)
+    {
+        EXPECT_EQ(filled[i].size(), 20000);
+        EXPECT_TRUE(filled[i].contains(19999 * lists + i));
+        EXPECT_FALSE(filled[i].contains(i + 1));
+    }
+}
+
+TEST(SkipListRebalanceTest, ShortensSearchesAfterErasures)
+{
+    SkipList<int> list(3);
+    for (int i = 0; i < 20000; ++i)
+    {
+        list.insert(i);
+    }
+    for (int i = 0; i < 20000; ++i)
+    {
+        if (i % 10 != 0)
+        {
+            ASSERT_TRUE(list.erase(i));
+        }
+    }
+
+    const double before = list.average_search_length();
+    list.rebalance();
+    EXPECT_LT(list.average_search_length(), before);
+    EXPECT_LE(list.get_current_level(), 12);
+
+    EXPECT_EQ(2000, list.size());
+    int expected = 0;
+    for (int value : list)
+    {
+        EXPECT_EQ(expected, value);
+        expected += 10;
+    }
+    for (int i = 0; i < 20000; ++i)
+    {
+        ASSERT_EQ(i % 10 == 0, list.contains(i));
+    }
+}
+
+TEST(SkipListRebalanceTest, ListStaysUsable)
+{
+    SkipList<int> list(5);
+    std::set<int> reference;
+    std::mt19937 gen(5);
+
+    for (int round = 0; round < 4; ++round)
+    {
+        for (int step = 0; step < 5000; ++step)
+        {
+            int value = static_cast<int>(gen() % 2000);
+            if (gen() % 3 == 0)
+            {
+                ASSERT_EQ(list.erase(value), reference.erase(value) == 1);
+            }
+            else
+            {
+                list.insert(value);
+                reference.insert(value);
+            }
+        }
+
+        if (round == 2)
+        {
+            list.compact();
+        }
+        else
+        {
+            list.rebalance();
+        }
+        ASSERT_EQ(list.size(), reference.size());
+        EXPECT_TRUE(std::equal(list.begin(), list.end(), reference.begin(), reference.end()));
+    }
+
+    for (int value : std::vector<int>(reference.begin(), reference.end()))
+    {
+        ASSERT_TRUE(list.erase(value));
+    }
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(0, list.get_current_level());
+}
+
+TEST(SkipListRebalanceTest, CompactKeepsRebalancedTowers)
+{
+    SkipList<int> list(3);
+    for (int i = 0; i < 20000; ++i)
+    {
+        list.insert(i);
+    }
+    for (int i = 0; i < 20000; ++i)
+    {
+        if (i % 10 != 0)
+        {
+            list.erase(i);
+        }
+    }
+
+    list.rebalance();
+    const double rebalanced = list.average_search_length();
+    const std::size_t level = list.get_current_level();
+
+    // Nodes are reported by the height they are linked at, not the one they were allocated with
+    std::vector<SkipList<int>::HeightStats> stats = list.height_stats();
+    std::size_t nodes = 0;
+    for (std::size_t height = 0; height < stats.size(); ++height)
+    {
+        nodes += stats[height].nodes;
+        if (height > level)
+        {
+            EXPECT_EQ(0, stats[height].nodes);
+        }
+    }
+    EXPECT_EQ(list.size(), nodes);
+
+    list.compact();
+    EXPECT_EQ(rebalanced, list.average_search_length());
+    EXPECT_EQ(level, list.get_current_level());
+
+    std::vector<SkipList<int>::HeightStats> compacted = list.height_stats();
+    std::size_t node_bytes = 0;
+    for (std::size_t height = 0; height < compacted.size(); ++height)
+    {
+        EXPECT_EQ(stats[height].nodes, compacted[height].nodes);
+        node_bytes += compacted[height].nodes * compacted[height].node_bytes;
+    }
+    EXPECT_LE(node_bytes, list.memory_usage());
+    for (int i = 0; i < 20000; ++i)
+    {
+        ASSERT_EQ(i % 10 == 0, list.contains(i));
+    }
+}
+
+TEST(SkipListRebalanceTest, AverageSearchLengthOfSmallLists)
+{
+    SkipList<int> list;
+    EXPECT_EQ(0, list.average_search_length());
+    list.rebalance();
+    EXPECT_TRUE(list.empty());
+
+    // A single element is found by the failed comparison on level 0
+    list.insert(7);
+    list.rebalance();
+    EXPECT_EQ(0, list.get_current_level());
+    EXPECT_EQ(1, list.average_search_length());
+}
+
+TEST(SkipListInsertRangeTest, MergesBatchAndCountsNewElements)
+{
+    SkipList<int> list;
+    for (int i = 0; i < 100; i += 2)
+    {
+        list.insert(i);
+    }
+
+    std::vector<int> batch = {7, 3, 98, 4, 3, 150, -1, 7, 0};
+    EXPECT_EQ(4, list.insert_range(batch.begin(), batch.end()));
+    EXPECT_EQ(54, list.size());
+    for (int value : {-1, 3, 7, 150})
+    {
+        EXPECT_TRUE(list.contains(value));
+    }
+    EXPECT_TRUE(std::is_sorted(list.begin(), list.end()));
+
+    EXPECT_EQ(0, list.insert_range(batch.begin(), batch.end()));
+    EXPECT_EQ(0, list.insert_range(batch.end(), batch.end()));
+    EXPECT_EQ(54, list.size());
+}
+
+TEST(SkipListInsertRangeTest, RandomBatchesMatchStdSet)
+{
+    SkipList<int, std::less<>, std::allocator<int>, CopyKeyCache<int>> list(9);
+    std::set<int> reference;
+    std::mt19937 gen(9);
+
+    // Sparse and dense batches, into an empty and a filled list
+    for (int range : {1000000, 1000, 50000, 300})
+    {
+        std::vector<int> batch;
+        for (int i = 0; i < 5000; ++i)
+        {
+            batch.push_back(static_cast<int>(gen() % range));
+        }
+
+        std::size_t before = reference.size();
+        reference.insert(batch.begin(), batch.end());
+        ASSERT_EQ(reference.size() - before, list.insert_range(batch.begin(), batch.end()));
+        ASSERT_EQ(reference.size(), list.size());
+        ASSERT_TRUE(std::equal(list.begin(), list.end(), reference.begin(), reference.end()));
+    }
+
+    for (int value : reference)
+    {
+        ASSERT_TRUE(list.contains(value));
+    }
+    list.insert(-5);
+    EXPECT_TRUE(list.erase(-5));
+}
+
+TEST(SkipListInsertRangeTest, LargeBatch)
+{
+    // Long enough to be sorted in slices on machines with several cores
+    std::vector<int> batch(300000);
+    for (std::size_t i = 0; i < batch.size(); ++i)
+    {
+        batch[i] = static_cast<int>((i * 7919) % batch.size());
+    }
+
+    SkipList<int> list;
+    list.insert(5);
+    EXPECT_EQ(batch.size() - 1, list.insert_range(batch.begin(), batch.end()));
+    EXPECT_EQ(batch.size(), list.size());
+
+    int expected = 0;
+    for (int value : list)
+    {
+        ASSERT_EQ(expected++, value);
+    }
+}
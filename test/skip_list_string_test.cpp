@@ -11,12 +11,12 @@ class SkipListStringTest : public ::testing::Test
         bool check_level_0(const std::vector<std::string>& expected_elements) 
         {
             std::vector<std::string> actual_elements;
-            std::shared_ptr<Node<std::string>> current = string_list.get_first_node_at_0();
+            Node<std::string>* current = string_list.get_first_node_at_0();
 
             while (current != nullptr) 
             {
                 actual_elements.push_back(current->getValue());
-                current = current->next[0];
+                current = current->next(0);
             }
 
             return expected_elements == actual_elements;
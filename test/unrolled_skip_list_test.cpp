@@ -0,0 +1,173 @@
+#include "gtest/gtest.h"
+#include "../include/unrolled_skip_list.h"
+
+#include <bit>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+TEST(UnrolledSkipListTest, Initialization)
+{
+    UnrolledSkipList<int> list;
+
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(0, list.block_count());
+    EXPECT_TRUE(list.begin() == list.end());
+    EXPECT_FALSE(list.contains(1));
+    EXPECT_FALSE(list.erase(1));
+}
+
+TEST(UnrolledSkipListTest, Insert_SortedIterationAndDuplicates)
+{
+    UnrolledSkipList<int, 4> list;
+    for (int value : {13, 5, 1, 22, 110, 79, 5, 1, 64, 8})
+    {
+        list.insert(value);
+    }
+
+    std::vector<int> actual(list.begin(), list.end());
+    EXPECT_EQ(actual, (std::vector<int>{1, 5, 8, 13, 22, 64, 79, 110}));
+    EXPECT_EQ(8, list.size());
+    EXPECT_GT(list.block_count(), 1);
+}
+
+TEST(UnrolledSkipListTest, Erase_MergesBlocks)
+{
+    UnrolledSkipList<int, 8> list;
+    for (int i = 0; i < 200; ++i)
+    {
+        list.insert(i);
+    }
+    std::size_t full_blocks = list.block_count();
+
+    for (int i = 0; i < 200; ++i)
+    {
+        if (i % 10 != 0)
+        {
+            ASSERT_TRUE(list.erase(i));
+        }
+    }
+
+    EXPECT_EQ(20, list.size());
+    EXPECT_LT(list.block_count(), full_blocks);
+    std::vector<int> actual(list.begin(), list.end());
+    std::vector<int> expected;
+    for (int i = 0; i < 200; i += 10)
+    {
+        expected.push_back(i);
+    }
+    EXPECT_EQ(actual, expected);
+}
+
+TEST(UnrolledSkipListTest, RandomOperations_MatchStdSet)
+{
+    UnrolledSkipList<int, 4> list;
+    std::set<int> reference;
+    std::mt19937 gen(3);
+
+    for (int step = 0; step < 20000; ++step)
+    {
+        int value = static_cast<int>(gen() % 500);
+        if (gen() % 3 == 0)
+        {
+            ASSERT_EQ(list.erase(value), reference.erase(value) == 1);
+        }
+        else
+        {
+            list.insert(value);
+            reference.insert(value);
+        }
+        ASSERT_EQ(list.contains(value), reference.count(value) == 1);
+    }
+
+    ASSERT_EQ(list.size(), reference.size());
+    EXPECT_TRUE(std::equal(list.cbegin(), list.cend(), reference.begin()));
+
+    for (int value : std::vector<int>(reference.begin(), reference.end()))
+    {
+        ASSERT_TRUE(list.erase(value));
+    }
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(0, list.block_count());
+}
+
+namespace
+{
+    // Wider alignment than operator new guarantees without std::align_val_t
+    struct alignas(64) Aligned
+    {
+        int key;
+
+        bool operator<(const Aligned& other) const { return key < other.key; }
+        bool operator==(const Aligned& other) const { return key == other.key; }
+    };
+}
+
+TEST(UnrolledSkipListTest, OverAlignedKeys)
+{
+    UnrolledSkipList<Aligned, 4> list;
+    for (int i = 0; i < 200; ++i)
+    {
+        list.insert(Aligned{(i * 37) % 200});
+    }
+
+    int expected = 0;
+    for (const Aligned& key : list)
+    {
+        EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(&key) % alignof(Aligned));
+        EXPECT_EQ(expected++, key.key);
+    }
+    for (int i = 0; i < 200; i += 2)
+    {
+        ASSERT_TRUE(list.erase(Aligned{i}));
+    }
+    EXPECT_EQ(100, list.size());
+}
+
+TEST(UnrolledSkipListTest, Strings_CopyAndMove)
+{
+    UnrolledSkipList<std::string, 4> list;
+    for (const char* word : {"Witch", "Apple", "Demon", "Banana", "Cherry", "Helicopter"})
+    {
+        list.insert(word);
+    }
+
+    UnrolledSkipList<std::string, 4> copied_list(list);
+    EXPECT_TRUE(copied_list == list);
+
+    list.erase("Apple");
+    EXPECT_TRUE(copied_list.contains("Apple"));
+    EXPECT_TRUE(copied_list < list);
+
+    UnrolledSkipList<std::string, 4> moved_list(std::move(list));
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(*moved_list.begin(), "Banana");
+    EXPECT_EQ(5, moved_list.size());
+}
+
+TEST(UnrolledSkipListTest, LevelsFollowBlockCount)
+{
+    UnrolledSkipList<int, 4> list(1);
+    for (int round = 0; round < 50; ++round)
+    {
+        list.clear();
+        for (int i = 0; i < 32; ++i)
+        {
+            list.insert(i);
+        }
+        // Towers index blocks, so draws are capped near log2(blocks) + 1
+        ASSERT_LE(list.get_current_level(), std::bit_width(list.block_count()) + 1);
+    }
+
+    UnrolledSkipList<int, 4> same_seed(1);
+    UnrolledSkipList<int, 4> again(1);
+    for (int i = 0; i < 10000; ++i)
+    {
+        same_seed.insert(i);
+        again.insert(i);
+    }
+    EXPECT_EQ(same_seed.get_current_level(), again.get_current_level());
+    EXPECT_GE(same_seed.get_current_level(), 8);
+}